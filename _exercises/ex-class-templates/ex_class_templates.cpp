@@ -1,3 +1,5 @@
+#include "trivially_relocatable.hpp"
+
 #include <algorithm>
 #include <array>
 #include <catch2/catch_template_test_macros.hpp>
@@ -150,6 +152,98 @@ namespace ver_3
 
 } // namespace ver_2
 
+namespace ver_4
+{
+    // own contiguous storage - growth relocates items with memcpy when IsTriviallyRelocatable_v<T>
+    template <typename T>
+    class Stack
+    {
+    public:
+        using value_type = T;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+
+        Stack() = default;
+
+        Stack(const Stack&) = delete;
+        Stack& operator=(const Stack&) = delete;
+
+        ~Stack()
+        {
+            std::destroy(items_, items_ + size_);
+            if (items_)
+                std::allocator<T>{}.deallocate(items_, capacity_);
+        }
+
+        bool empty() const
+        {
+            return size_ == 0;
+        }
+
+        size_t size() const
+        {
+            return size_;
+        }
+
+        size_t capacity() const
+        {
+            return capacity_;
+        }
+
+        void reserve(size_t new_capacity)
+        {
+            if (new_capacity <= capacity_)
+                return;
+
+            T* new_items = std::allocator<T>{}.allocate(new_capacity);
+            try
+            {
+                uninitialized_relocate(items_, items_ + size_, new_items);
+            }
+            catch (...)
+            {
+                std::allocator<T>{}.deallocate(new_items, new_capacity);
+                throw;
+            }
+
+            if (items_)
+                std::allocator<T>{}.deallocate(items_, capacity_);
+            items_ = new_items;
+            capacity_ = new_capacity;
+        }
+
+        void push(auto&& elem)
+        {
+            if (size_ == capacity_)
+            {
+                T temp(std::forward<decltype(elem)>(elem)); // elem may refer to an item of this stack
+                reserve(capacity_ == 0 ? 1 : 2 * capacity_);
+                std::construct_at(items_ + size_, std::move(temp));
+            }
+            else
+                std::construct_at(items_ + size_, std::forward<decltype(elem)>(elem));
+
+            ++size_;
+        }
+
+        const_reference top() const
+        {
+            return items_[size_ - 1];
+        }
+
+        void pop(reference t_value)
+        {
+            t_value = std::move(items_[size_ - 1]);
+            std::destroy_at(items_ + --size_);
+        }
+
+    private:
+        T* items_{};
+        size_t size_{};
+        size_t capacity_{};
+    };
+} // namespace ver_4
+
 static_assert(std::is_same_v<Stack<int>::container_type, std::deque<int>>);
 static_assert(std::is_same_v<Stack<int, std::vector<int>>::container_type, std::vector<int>>);
 
@@ -271,3 +365,28 @@ TEST_CASE("Popping all items")
     auto values = pop_all(s);
     REQUIRE(values.size() == 2);
 }
+
+TEST_CASE("Stack with relocatable storage")
+{
+    ver_4::Stack<std::unique_ptr<int>> s;
+
+    for (int i = 0; i < 100; ++i)
+        s.push(std::make_unique<int>(i));
+
+    REQUIRE(s.size() == 100);
+    REQUIRE(s.capacity() >= 100);
+    REQUIRE(*s.top() == 99);
+
+    std::unique_ptr<int> item;
+    s.pop(item);
+    REQUIRE(*item == 99);
+    REQUIRE(*s.top() == 98);
+
+    ver_4::Stack<std::string> words;
+    words.push("a text longer than the small string buffer");
+    words.push(words.top());
+    words.push("text");
+
+    auto values = pop_all(words);
+    REQUIRE(values == std::vector<std::string>{"text", "a text longer than the small string buffer", "a text longer than the small string buffer"});
+}
@@ -1,3 +1,6 @@
+#include "container_concepts.hpp"
+#include "traversal.hpp"
+
 #include <catch2/catch_test_macros.hpp>
 #include <forward_list>
 #include <iostream>
@@ -5,6 +8,7 @@
 #include <map>
 #include <set>
 #include <source_location>
+#include <sstream>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -21,15 +25,6 @@ Iterator concept
 
 constexpr static bool TODO = false;
 
-template <typename I>
-concept Iterator = requires(I iterator) {
-    *iterator;   // simple requirement
-    { ++iterator } -> std::same_as<I&>; // compound requirement
-    iterator++;
-    iterator == iterator;
-    iterator != iterator;
-};
-
 namespace Alt
 {
    template <typename I>
@@ -58,16 +53,6 @@ StdContainer concept
 5. has inner type value type
 **********************/
 
-template <typename Container>
-concept StdContainer = requires(Container container) {
-    typename Container::iterator;     // type requirement
-    typename Container::const_iterator;
-    typename Container::value_type;
-
-    { std::begin(container) } -> Iterator;
-    { std::end(container) } -> Iterator;
-};
-
 TEST_CASE("StdContainer")
 {
     static_assert(StdContainer<std::vector<int>>);
@@ -87,29 +72,6 @@ Indexable concept
 1. can be indexed
 **********************/
 
-template <typename T>
-struct IndexType
-{
-    using type = size_t;
-};
-
-template <typename T>
-concept HasKeyType = requires { typename T::key_type; };
-
-template <HasKeyType T>
-struct IndexType<T>
-{
-    using type = typename T::key_type;
-};
-
-template <typename T>
-using IndexType_t = typename IndexType<T>::type;
-
-template <typename C>
-concept Indexable = requires(C container, IndexType_t<C> index) {
-    container[index];
-};
-
 TEST_CASE("Indexable")
 {
     static_assert(Indexable<std::vector<int>>);
@@ -131,9 +93,6 @@ IndexableStdContainer concept
 2. is indexable
 **********************/
 
-template <typename C>
-concept IndexableStdContainer = Indexable<C> && StdContainer<C>;
-
 TEST_CASE("IndexableStdContainer")
 {
     static_assert(IndexableStdContainer<std::vector<int>>);
@@ -147,26 +106,10 @@ TEST_CASE("IndexableStdContainer")
     static_assert(!IndexableStdContainer<int[10]>);
 }
 
-void print_all(const StdContainer auto& container)
+// the traversal is chosen by for_each_item (see traversal.hpp) - maps are not indexed with positions
+void print_all(const StdContainer auto& container, std::ostream& out = std::cout)
 {
-    std::cout << "void print_all(const StdContainer auto& container)\n";
-
-    for (const auto& item : container)
-    {
-        std::cout << item << " ";
-    }
-    std::cout << "\n";
-}
-
-void print_all(const IndexableStdContainer auto& container)
-{
-    std::cout << "void print_all(const IndexableContainer auto& container)\n";
-
-    for (size_t i = 0; i < std::size(container); ++i)
-    {
-        std::cout << container[i] << " ";
-    }
-    std::cout << "\n";
+    write_all(out, container);
 }
 
 TEST_CASE("container concepts")
@@ -176,4 +119,11 @@ TEST_CASE("container concepts")
 
     std::list lst{1, 2, 3};
     print_all(lst);
+
+    std::map<int, std::string> dict = {{1, "one"}, {2, "two"}};
+    print_all(dict);
+
+    std::ostringstream out;
+    print_all(dict, out);
+    CHECK(out.str() == "1: one 2: two \n");
 }
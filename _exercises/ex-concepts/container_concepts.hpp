@@ -0,0 +1,57 @@
+#ifndef EX_CONCEPTS_CONTAINER_CONCEPTS_HPP
+#define EX_CONCEPTS_CONTAINER_CONCEPTS_HPP
+
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+
+/////////////////////////////////////////////////////////////////
+// Container concepts - used by the exercises in concepts_and_constraints.cpp
+// and by the expression templates
+
+template <typename I>
+concept Iterator = requires(I iterator) {
+    *iterator;   // simple requirement
+    { ++iterator } -> std::same_as<I&>; // compound requirement
+    iterator++;
+    iterator == iterator;
+    iterator != iterator;
+};
+
+template <typename Container>
+concept StdContainer = requires(Container container) {
+    typename Container::iterator;     // type requirement
+    typename Container::const_iterator;
+    typename Container::value_type;
+
+    { std::begin(container) } -> Iterator;
+    { std::end(container) } -> Iterator;
+};
+
+template <typename T>
+struct IndexType
+{
+    using type = size_t;
+};
+
+template <typename T>
+concept HasKeyType = requires { typename T::key_type; };
+
+template <HasKeyType T>
+struct IndexType<T>
+{
+    using type = typename T::key_type;
+};
+
+template <typename T>
+using IndexType_t = typename IndexType<T>::type;
+
+template <typename C>
+concept Indexable = requires(C container, IndexType_t<C> index) {
+    container[index];
+};
+
+template <typename C>
+concept IndexableStdContainer = Indexable<C> && StdContainer<C>;
+
+#endif // EX_CONCEPTS_CONTAINER_CONCEPTS_HPP
@@ -0,0 +1,275 @@
+#ifndef EX_CONCEPTS_EXPRESSION_TEMPLATES_HPP
+#define EX_CONCEPTS_EXPRESSION_TEMPLATES_HPP
+
+#include "container_concepts.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////
+// Expression templates - lazy element-wise arithmetic over containers
+//
+// auto expr = lazy(a) + lazy(b) * c; // builds a tree, nothing is computed
+// lazy(result) = expr;               // one fused loop, no temporary containers
+//
+// At least one operand of an operator must be an expression - lazy() marks
+// a container as one. Other operands may be containers or scalars.
+
+namespace ExpressionTemplates
+{
+    // containers indexed with positions 0..size-1 (maps are indexed with keys)
+    template <typename C>
+    concept Sequence = IndexableStdContainer<C> && !HasKeyType<C> && requires(const C& container) {
+        { std::size(container) } -> std::convertible_to<size_t>;
+    };
+
+    struct ExpressionTag
+    { };
+
+    template <typename E>
+    concept Expression = std::derived_from<std::remove_cvref_t<E>, ExpressionTag>;
+
+    template <Sequence C, Expression E>
+    void assign(C& destination, const E& expr);
+
+    /////////////////////////////////////////////////////////////////
+    // Terminal - leaf of a tree referencing (lvalue) or owning (rvalue) a container
+
+    template <typename C>
+    class Terminal : public ExpressionTag
+    {
+        C container_;
+
+    public:
+        using container_type = std::remove_cvref_t<C>;
+        using value_type = typename container_type::value_type;
+
+        explicit Terminal(C&& container)
+            : container_(std::forward<C>(container))
+        { }
+
+        Terminal(const Terminal&) = default;
+        Terminal(Terminal&&) = default;
+
+        size_t size() const
+        {
+            return std::size(container_);
+        }
+
+        decltype(auto) operator[](size_t index) const
+        {
+            return std::as_const(container_)[index];
+        }
+
+        // lazy(result) = expression;
+        template <Expression E>
+            requires(!std::is_const_v<std::remove_reference_t<C>>)
+        Terminal& operator=(const E& expr)
+        {
+            assign(container_, expr);
+            return *this;
+        }
+
+        // lazy(result) = lazy(source); - copies elements like any other expression
+        // (the implicit copy assignment would be deleted for a referencing terminal)
+        Terminal& operator=(const Terminal& other)
+            requires(!std::is_const_v<std::remove_reference_t<C>>)
+        {
+            assign(container_, other);
+            return *this;
+        }
+    };
+
+    template <Sequence C>
+    Terminal<C&> lazy(C& container)
+    {
+        return Terminal<C&>{container};
+    }
+
+    template <Sequence C>
+    Terminal<C> lazy(C&& container)
+    {
+        return Terminal<C>{std::move(container)};
+    }
+
+    template <typename T>
+    class Scalar : public ExpressionTag
+    {
+        T value_;
+
+    public:
+        using value_type = T;
+
+        explicit Scalar(T value)
+            : value_{value}
+        { }
+
+        static constexpr bool is_scalar = true;
+
+        T operator[](size_t) const
+        {
+            return value_;
+        }
+    };
+
+    template <typename E>
+    constexpr bool IsScalar_v = requires { std::remove_cvref_t<E>::is_scalar; };
+
+    /////////////////////////////////////////////////////////////////
+    // inner nodes - subexpressions are stored by value (they only hold references)
+
+    template <typename Op, typename E>
+    class UnaryExpr : public ExpressionTag
+    {
+        E expr_;
+
+    public:
+        using value_type = std::remove_cvref_t<std::invoke_result_t<Op, decltype(std::declval<const E&>()[0])>>;
+
+        explicit UnaryExpr(E expr)
+            : expr_{std::move(expr)}
+        { }
+
+        size_t size() const
+        {
+            return expr_.size();
+        }
+
+        value_type operator[](size_t index) const
+        {
+            return Op{}(expr_[index]);
+        }
+    };
+
+    template <typename Op, typename L, typename R>
+    class BinaryExpr : public ExpressionTag
+    {
+        L lhs_;
+        R rhs_;
+
+    public:
+        using value_type = std::remove_cvref_t<
+            std::invoke_result_t<Op, decltype(std::declval<const L&>()[0]), decltype(std::declval<const R&>()[0])>>;
+
+        BinaryExpr(L lhs, R rhs)
+            : lhs_{std::move(lhs)}
+            , rhs_{std::move(rhs)}
+        {
+            if constexpr (!IsScalar_v<L> && !IsScalar_v<R>)
+                if (lhs_.size() != rhs_.size())
+                    throw std::length_error("Sizes of operands do not match");
+        }
+
+        size_t size() const
+        {
+            if constexpr (IsScalar_v<L>)
+                return rhs_.size();
+            else
+                return lhs_.size();
+        }
+
+        value_type operator[](size_t index) const
+        {
+            return Op{}(lhs_[index], rhs_[index]);
+        }
+    };
+
+    namespace Detail
+    {
+        template <typename T>
+        decltype(auto) as_expression(T&& operand)
+        {
+            if constexpr (Expression<T>)
+                return std::remove_cvref_t<T>(std::forward<T>(operand));
+            else if constexpr (Sequence<std::remove_cvref_t<T>>)
+                return lazy(std::forward<T>(operand));
+            else
+                return Scalar<std::remove_cvref_t<T>>{operand};
+        }
+
+        template <typename T>
+        using AsExpression = decltype(as_expression(std::declval<T>()));
+
+        template <typename Op, typename L, typename R>
+        auto make_binary(L&& lhs, R&& rhs)
+        {
+            return BinaryExpr<Op, AsExpression<L&&>, AsExpression<R&&>>{
+                as_expression(std::forward<L>(lhs)), as_expression(std::forward<R>(rhs))};
+        }
+
+        template <typename T>
+        concept Operand = Expression<T> || Sequence<std::remove_cvref_t<T>> || std::is_arithmetic_v<std::remove_cvref_t<T>>;
+    } // namespace Detail
+
+    template <Detail::Operand L, Detail::Operand R>
+        requires Expression<L> || Expression<R>
+    auto operator+(L&& lhs, R&& rhs)
+    {
+        return Detail::make_binary<std::plus<>>(std::forward<L>(lhs), std::forward<R>(rhs));
+    }
+
+    template <Detail::Operand L, Detail::Operand R>
+        requires Expression<L> || Expression<R>
+    auto operator-(L&& lhs, R&& rhs)
+    {
+        return Detail::make_binary<std::minus<>>(std::forward<L>(lhs), std::forward<R>(rhs));
+    }
+
+    template <Detail::Operand L, Detail::Operand R>
+        requires Expression<L> || Expression<R>
+    auto operator*(L&& lhs, R&& rhs)
+    {
+        return Detail::make_binary<std::multiplies<>>(std::forward<L>(lhs), std::forward<R>(rhs));
+    }
+
+    template <Detail::Operand L, Detail::Operand R>
+        requires Expression<L> || Expression<R>
+    auto operator/(L&& lhs, R&& rhs)
+    {
+        return Detail::make_binary<std::divides<>>(std::forward<L>(lhs), std::forward<R>(rhs));
+    }
+
+    template <Expression E>
+    auto operator-(E&& expr)
+    {
+        using Operand = std::remove_cvref_t<E>;
+        return UnaryExpr<std::negate<>, Operand>{std::forward<E>(expr)};
+    }
+
+    /////////////////////////////////////////////////////////////////
+    // evaluation - a single loop over all operands
+
+    // element i of the result depends only on element i of operands,
+    // so the destination may also be an operand of the expression
+    template <Sequence C, Expression E>
+    void assign(C& destination, const E& expr)
+    {
+        const size_t size = expr.size();
+
+        if constexpr (requires { destination.resize(size); })
+            destination.resize(size);
+        else if (std::size(destination) != size)
+            throw std::length_error("Size of destination does not match");
+
+        for (size_t i = 0; i < size; ++i)
+            destination[i] = expr[i];
+    }
+
+    template <typename C = void, Expression E>
+    auto evaluate(const E& expr)
+    {
+        using Container = std::conditional_t<std::is_void_v<C>, std::vector<typename std::remove_cvref_t<E>::value_type>, C>;
+
+        Container result{};
+        assign(result, expr);
+        return result;
+    }
+} // namespace ExpressionTemplates
+
+#endif // EX_CONCEPTS_EXPRESSION_TEMPLATES_HPP
@@ -0,0 +1,142 @@
+#include "expression_templates.hpp"
+
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <deque>
+#include <list>
+#include <stdexcept>
+#include <vector>
+
+using namespace ExpressionTemplates;
+
+TEST_CASE("Sequence")
+{
+    static_assert(Sequence<std::vector<int>>);
+    static_assert(Sequence<std::deque<double>>);
+    static_assert(Sequence<std::array<int, 4>>);
+    static_assert(!Sequence<std::list<int>>);
+    static_assert(!Sequence<std::map<size_t, int>>);
+}
+
+TEST_CASE("expression templates")
+{
+    std::vector<int> a = {1, 2, 3, 4};
+    std::vector<int> b = {10, 20, 30, 40};
+    std::deque<int> c = {2, 2, 2, 2};
+
+    SECTION("expression is lazy")
+    {
+        auto expr = lazy(a) + b * lazy(c);
+        static_assert(Expression<decltype(expr)>);
+
+        a[0] = 101;
+        CHECK(expr[0] == 121);
+        CHECK(expr.size() == 4);
+    }
+
+    SECTION("assignment evaluates the expression")
+    {
+        std::vector<int> result;
+        lazy(result) = lazy(a) + lazy(b) * c;
+
+        CHECK(result == std::vector{21, 42, 63, 84});
+    }
+
+    SECTION("terminal assigned to terminal")
+    {
+        std::vector<int> result;
+        lazy(result) = lazy(a);
+        CHECK(result == a);
+
+        std::array<int, 4> fixed{};
+        lazy(fixed) = lazy(b);
+        CHECK(fixed == std::array{10, 20, 30, 40});
+
+        auto source = lazy(c);
+        auto destination = lazy(a);
+        destination = source;
+        CHECK(a == std::vector{2, 2, 2, 2});
+    }
+
+    SECTION("scalars & unary minus")
+    {
+        auto result = evaluate(2 * -lazy(a) + 1.5);
+
+        static_assert(std::is_same_v<decltype(result), std::vector<double>>);
+        CHECK(result == std::vector{-0.5, -2.5, -4.5, -6.5});
+    }
+
+    SECTION("destination may be an operand")
+    {
+        lazy(a) = lazy(a) * a - lazy(b) / 10;
+        CHECK(a == std::vector{0, 2, 6, 12});
+    }
+
+    SECTION("evaluation to fixed-size container")
+    {
+        auto result = evaluate<std::array<int, 4>>(lazy(b) - lazy(a));
+        CHECK(result == std::array{9, 18, 27, 36});
+    }
+
+    SECTION("temporary containers are owned by the expression")
+    {
+        auto expr = lazy(std::vector{1, 1, 1, 1}) + a;
+        CHECK(evaluate(expr) == std::vector{2, 3, 4, 5});
+    }
+
+    SECTION("sizes of operands must match")
+    {
+        std::vector<int> other = {1, 2};
+        CHECK_THROWS_AS(lazy(a) + other, std::length_error);
+    }
+}
+
+namespace Eager
+{
+    std::vector<double> operator+(const std::vector<double>& a, const std::vector<double>& b)
+    {
+        std::vector<double> result(a.size());
+        for (size_t i = 0; i < a.size(); ++i)
+            result[i] = a[i] + b[i];
+        return result;
+    }
+
+    std::vector<double> operator*(const std::vector<double>& a, const std::vector<double>& b)
+    {
+        std::vector<double> result(a.size());
+        for (size_t i = 0; i < a.size(); ++i)
+            result[i] = a[i] * b[i];
+        return result;
+    }
+
+    std::vector<double> operator*(const std::vector<double>& a, double value)
+    {
+        std::vector<double> result(a.size());
+        for (size_t i = 0; i < a.size(); ++i)
+            result[i] = a[i] * value;
+        return result;
+    }
+} // namespace Eager
+
+TEST_CASE("expression templates vs. eager operations", "[.][benchmark]")
+{
+    for (size_t size : {1'000, 1'000'000})
+    {
+        std::vector<double> a(size, 1.0), b(size, 2.0), c(size, 3.0), d(size, 4.0);
+        std::vector<double> result(size);
+
+        BENCHMARK("eager - 3 temporaries - size " + std::to_string(size))
+        {
+            using namespace Eager;
+            result = a + b * c + d * 0.5;
+            return result.back();
+        };
+
+        BENCHMARK("lazy - fused loop - size " + std::to_string(size))
+        {
+            lazy(result) = lazy(a) + lazy(b) * c + lazy(d) * 0.5;
+            return result.back();
+        };
+    }
+}
@@ -0,0 +1,211 @@
+#ifndef EX_CONCEPTS_SERIALIZATION_HPP
+#define EX_CONCEPTS_SERIALIZATION_HPP
+
+#include "container_concepts.hpp"
+#include "traversal.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <ios>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+/////////////////////////////////////////////////////////////////
+// ContiguousTriviallyCopyableContainer - items form a single block of bytes
+
+template <typename C>
+concept ContiguousTriviallyCopyableContainer = ContiguousContainer<C> && std::is_trivially_copyable_v<typename C::value_type>;
+
+/////////////////////////////////////////////////////////////////
+// Serialization - binary I/O of containers
+//
+// A container is stored as its item count (uint64_t) followed by its items.
+// Contiguous, trivially copyable containers are written & read with a single
+// call; other containers are streamed item by item (maps as key & value pairs,
+// nested containers recursively). Data is stored in native byte order.
+
+namespace Serialization
+{
+    template <typename T>
+    void write(std::ostream& out, const T& value);
+
+    template <typename T>
+    void read(std::istream& in, T& value);
+
+    namespace Detail
+    {
+        inline void write_bytes(std::ostream& out, const void* data, size_t size)
+        {
+            if (!out.write(static_cast<const char*>(data), static_cast<std::streamsize>(size)))
+                throw std::ios_base::failure("Serialization: write failed");
+        }
+
+        inline void read_bytes(std::istream& in, void* data, size_t size)
+        {
+            if (!in.read(static_cast<char*>(data), static_cast<std::streamsize>(size)))
+                throw std::ios_base::failure("Serialization: unexpected end of data");
+        }
+
+        template <typename C>
+        void prepare(C& container, size_t size)
+        {
+            if constexpr (requires { container.resize(size); })
+                container.resize(size);
+            else if (std::size(container) != size)
+                throw std::length_error("Serialization: size of fixed-size container does not match");
+        }
+
+        template <typename C>
+        void insert_item(C& container, typename C::value_type&& item)
+        {
+            if constexpr (requires { container.push_back(std::move(item)); })
+                container.push_back(std::move(item));
+            else
+                container.insert(container.end(), std::move(item));
+        }
+
+        // the key of map items is const - it is read into a separate object
+        template <typename T>
+        struct ReadableValue
+        {
+            using type = T;
+        };
+
+        template <typename K, typename V>
+        struct ReadableValue<std::pair<const K, V>>
+        {
+            using type = std::pair<K, V>;
+        };
+    } // namespace Detail
+
+    /////////////////////////////////////////////////////////////////
+    // write
+
+    template <ContiguousTriviallyCopyableContainer C>
+    void write_container(std::ostream& out, const C& container)
+    {
+        const uint64_t size = std::size(container);
+        Detail::write_bytes(out, &size, sizeof(size));
+        Detail::write_bytes(out, std::to_address(std::begin(container)), size * sizeof(typename C::value_type));
+    }
+
+    template <StdContainer C>
+    void write_container(std::ostream& out, const C& container)
+    {
+        const uint64_t size = std::size(container);
+        Detail::write_bytes(out, &size, sizeof(size));
+        for_each_item(container, [&](const auto& item) { write(out, item); });
+    }
+
+    template <typename T>
+    void write(std::ostream& out, const T& value)
+    {
+        if constexpr (StdContainer<T>)
+            write_container(out, value);
+        else if constexpr (requires { value.first; value.second; })
+        {
+            write(out, value.first);
+            write(out, value.second);
+        }
+        else
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "Type cannot be serialized");
+            Detail::write_bytes(out, std::addressof(value), sizeof(T));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////
+    // read
+
+    template <ContiguousTriviallyCopyableContainer C>
+    void read_container(std::istream& in, C& container)
+    {
+        uint64_t size{};
+        Detail::read_bytes(in, &size, sizeof(size));
+
+        Detail::prepare(container, size);
+        Detail::read_bytes(in, std::to_address(std::begin(container)), size * sizeof(typename C::value_type));
+    }
+
+    template <StdContainer C>
+    void read_container(std::istream& in, C& container)
+    {
+        uint64_t size{};
+        Detail::read_bytes(in, &size, sizeof(size));
+
+        if constexpr (RandomAccessContainer<C>)
+        {
+            Detail::prepare(container, size);
+            for (auto it = std::begin(container); size > 0; --size, ++it)
+            {
+                typename C::value_type item{};
+                read(in, item);
+                *it = std::move(item);
+            }
+        }
+        else
+        {
+            container.clear();
+            for (; size > 0; --size)
+            {
+                typename Detail::ReadableValue<typename C::value_type>::type item{};
+                read(in, item);
+                Detail::insert_item(container, std::move(item));
+            }
+        }
+    }
+
+    template <typename T>
+    void read(std::istream& in, T& value)
+    {
+        if constexpr (StdContainer<T>)
+            read_container(in, value);
+        else if constexpr (requires { value.first; value.second; })
+        {
+            read(in, value.first);
+            read(in, value.second);
+        }
+        else
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "Type cannot be deserialized");
+            Detail::read_bytes(in, std::addressof(value), sizeof(T));
+        }
+    }
+
+    template <typename T>
+    T read(std::istream& in)
+    {
+        T value{};
+        read(in, value);
+        return value;
+    }
+
+    /////////////////////////////////////////////////////////////////
+    // files
+
+    template <typename T>
+    void save(const std::string& path, const T& value)
+    {
+        std::ofstream out{path, std::ios::binary | std::ios::trunc};
+        if (!out)
+            throw std::ios_base::failure("Cannot open file " + path);
+
+        write(out, value);
+    }
+
+    template <typename T>
+    T load(const std::string& path)
+    {
+        std::ifstream in{path, std::ios::binary};
+        if (!in)
+            throw std::ios_base::failure("Cannot open file " + path);
+
+        return read<T>(in);
+    }
+} // namespace Serialization
+
+#endif // EX_CONCEPTS_SERIALIZATION_HPP
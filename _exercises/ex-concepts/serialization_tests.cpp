@@ -0,0 +1,158 @@
+#include "serialization.hpp"
+
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <deque>
+#include <filesystem>
+#include <list>
+#include <map>
+#include <numeric>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if __has_include(<unistd.h>)
+#include <unistd.h>
+#else
+#include <random>
+#endif
+
+using namespace std::literals;
+
+namespace
+{
+    struct Point
+    {
+        double x, y;
+
+        bool operator==(const Point&) const = default;
+    };
+
+    template <typename T>
+    T round_trip(const T& value)
+    {
+        std::stringstream buffer;
+        Serialization::write(buffer, value);
+        return Serialization::read<T>(buffer);
+    }
+
+    // unique per process - test runs (e.g. of two build trees) may overlap
+    std::string temp_path(const std::string& name)
+    {
+#if __has_include(<unistd.h>)
+        const auto id = ::getpid();
+#else
+        const auto id = std::random_device{}();
+#endif
+        return (std::filesystem::temp_directory_path() / (name + "_" + std::to_string(id) + ".bin")).string();
+    }
+} // namespace
+
+TEST_CASE("ContiguousTriviallyCopyableContainer")
+{
+    static_assert(ContiguousTriviallyCopyableContainer<std::vector<int>>);
+    static_assert(ContiguousTriviallyCopyableContainer<std::vector<Point>>);
+    static_assert(ContiguousTriviallyCopyableContainer<std::array<double, 4>>);
+    static_assert(ContiguousTriviallyCopyableContainer<std::string>);
+    static_assert(!ContiguousTriviallyCopyableContainer<std::vector<std::string>>);
+    static_assert(!ContiguousTriviallyCopyableContainer<std::vector<bool>>);
+    static_assert(!ContiguousTriviallyCopyableContainer<std::deque<int>>);
+    static_assert(!ContiguousTriviallyCopyableContainer<std::list<int>>);
+}
+
+TEST_CASE("Serialization - round trip")
+{
+    SECTION("contiguous containers")
+    {
+        CHECK(round_trip(std::vector{1, 2, 3}) == std::vector{1, 2, 3});
+        CHECK(round_trip(std::vector<Point>{{1, 2}, {3, 4}}) == std::vector<Point>{{1, 2}, {3, 4}});
+        CHECK(round_trip("text"s) == "text");
+        CHECK(round_trip(std::array{1.5, 2.5}) == std::array{1.5, 2.5});
+        CHECK(round_trip(std::vector<int>{}).empty());
+    }
+
+    SECTION("other containers are streamed item by item")
+    {
+        CHECK(round_trip(std::deque{1, 2, 3}) == std::deque{1, 2, 3});
+        CHECK(round_trip(std::list{1, 2, 3}) == std::list{1, 2, 3});
+        CHECK(round_trip(std::vector<bool>{true, false, true}) == std::vector<bool>{true, false, true});
+        CHECK(round_trip(std::set{3, 1, 2}) == std::set{1, 2, 3});
+    }
+
+    SECTION("nested containers & maps")
+    {
+        std::vector<std::string> words = {"one", "two", "three"};
+        CHECK(round_trip(words) == words);
+
+        std::map<std::string, std::vector<int>> dict = {{"odd", {1, 3}}, {"even", {2, 4, 6}}};
+        CHECK(round_trip(dict) == dict);
+    }
+}
+
+TEST_CASE("Serialization - errors")
+{
+    std::stringstream buffer;
+    Serialization::write(buffer, std::vector{1, 2, 3});
+
+    SECTION("truncated data")
+    {
+        std::stringstream truncated{buffer.str().substr(0, 12)};
+        CHECK_THROWS_AS(Serialization::read<std::vector<int>>(truncated), std::ios_base::failure);
+    }
+
+    SECTION("fixed-size container")
+    {
+        CHECK_THROWS_AS((Serialization::read<std::array<int, 2>>(buffer)), std::length_error);
+    }
+
+    SECTION("missing file")
+    {
+        CHECK_THROWS_AS(Serialization::load<std::vector<int>>("/nonexistent/checkpoint.bin"), std::ios_base::failure);
+    }
+}
+
+TEST_CASE("Serialization - files")
+{
+    const auto path = temp_path("serialization_tests");
+
+    std::vector<int> data(1'000);
+    std::iota(data.begin(), data.end(), 0);
+
+    Serialization::save(path, data);
+    CHECK(Serialization::load<std::vector<int>>(path) == data);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Serialization - checkpoint of 10^7 values", "[.][benchmark]")
+{
+    const auto path = temp_path("serialization_benchmark");
+
+    std::vector<int> values(10'000'000);
+    std::iota(values.begin(), values.end(), 0);
+    std::deque<int> deque_values(values.begin(), values.end());
+
+    BENCHMARK("save - vector<int> - single write")
+    {
+        Serialization::save(path, values);
+    };
+
+    BENCHMARK("load - vector<int> - single read")
+    {
+        return Serialization::load<std::vector<int>>(path).size();
+    };
+
+    BENCHMARK("save - deque<int> - item by item")
+    {
+        Serialization::save(path, deque_values);
+    };
+
+    BENCHMARK("load - deque<int> - item by item")
+    {
+        return Serialization::load<std::deque<int>>(path).size();
+    };
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,115 @@
+#ifndef EX_CONCEPTS_TRAVERSAL_HPP
+#define EX_CONCEPTS_TRAVERSAL_HPP
+
+#include "container_concepts.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+/////////////////////////////////////////////////////////////////
+// Traversal - the cheapest way to visit all items of a container
+//
+// operator[] is not a good hint: for maps it is a lookup by key (and inserts
+// into a mutable map). The strategy is chosen from the iterator category:
+// a pointer walk for contiguous storage, a counted walk for random access,
+// an iterator walk otherwise - each visits n items in O(n).
+
+enum class TraversalStrategy
+{
+    contiguous,
+    random_access,
+    iterator
+};
+
+template <typename C>
+concept RandomAccessContainer = StdContainer<C> && !HasKeyType<C>
+    && std::random_access_iterator<typename C::const_iterator>;
+
+// subsumes RandomAccessContainer - overloads for contiguous containers are more specialized
+template <typename C>
+concept ContiguousContainer = RandomAccessContainer<C> && std::contiguous_iterator<typename C::const_iterator>;
+
+template <StdContainer C>
+constexpr TraversalStrategy traversal_strategy()
+{
+    return TraversalStrategy::iterator;
+}
+
+template <RandomAccessContainer C>
+constexpr TraversalStrategy traversal_strategy()
+{
+    return TraversalStrategy::random_access;
+}
+
+template <ContiguousContainer C>
+constexpr TraversalStrategy traversal_strategy()
+{
+    return TraversalStrategy::contiguous;
+}
+
+template <StdContainer C, typename F>
+void for_each_item(const C& container, F&& f)
+{
+    for (auto it = std::begin(container), last = std::end(container); it != last; ++it)
+        f(*it);
+}
+
+// a counted loop: the trip count is known up-front, while first[i] would recompute
+// the position for every item (a block lookup for std::deque, a bit mask for std::vector<bool>)
+template <RandomAccessContainer C, typename F>
+void for_each_item(const C& container, F&& f)
+{
+    auto it = std::begin(container);
+
+    for (size_t count = std::size(container); count > 0; --count, ++it)
+        f(*it);
+}
+
+template <ContiguousContainer C, typename F>
+void for_each_item(const C& container, F&& f)
+{
+    const auto* first = std::to_address(std::begin(container));
+    const auto* last = first + std::size(container);
+
+    for (; first != last; ++first)
+        f(*first);
+}
+
+/////////////////////////////////////////////////////////////////
+// write_item - items of maps are printed as key: value
+
+template <typename T>
+void write_item(std::ostream& out, const T& item)
+{
+    out << item;
+}
+
+template <typename K, typename V>
+void write_item(std::ostream& out, const std::pair<K, V>& item)
+{
+    out << item.first << ": " << item.second;
+}
+
+// all items are formatted into a buffer and written to the stream at once
+template <StdContainer C>
+void write_all(std::ostream& out, const C& container, std::string_view separator = " ")
+{
+    std::ostringstream buffer;
+
+    for_each_item(container, [&](const auto& item) {
+        write_item(buffer, item);
+        buffer << separator;
+    });
+    buffer << "\n";
+
+    const auto text = std::move(buffer).str();
+    out.write(text.data(), static_cast<std::streamsize>(text.size()));
+}
+
+#endif // EX_CONCEPTS_TRAVERSAL_HPP
@@ -0,0 +1,145 @@
+#include "traversal.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <deque>
+#include <list>
+#include <map>
+#include <numeric>
+#include <set>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+TEST_CASE("traversal strategy")
+{
+    static_assert(traversal_strategy<std::vector<int>>() == TraversalStrategy::contiguous);
+    static_assert(traversal_strategy<std::string>() == TraversalStrategy::contiguous);
+    static_assert(traversal_strategy<std::deque<int>>() == TraversalStrategy::random_access);
+    static_assert(traversal_strategy<std::vector<bool>>() == TraversalStrategy::random_access);
+    static_assert(traversal_strategy<std::list<int>>() == TraversalStrategy::iterator);
+    static_assert(traversal_strategy<std::map<size_t, int>>() == TraversalStrategy::iterator);
+    static_assert(traversal_strategy<std::unordered_map<size_t, int>>() == TraversalStrategy::iterator);
+}
+
+TEST_CASE("for_each_item visits all items in order")
+{
+    auto collect = [](const auto& container) {
+        std::vector<int> items;
+        for_each_item(container, [&](const auto& item) { items.push_back(item); });
+        return items;
+    };
+
+    const std::vector expected = {1, 2, 3};
+
+    CHECK(collect(std::vector{1, 2, 3}) == expected);
+    CHECK(collect(std::deque{1, 2, 3}) == expected);
+    CHECK(collect(std::list{1, 2, 3}) == expected);
+    CHECK(collect(std::set{3, 1, 2}) == expected);
+}
+
+TEST_CASE("write_all")
+{
+    std::ostringstream out;
+
+    SECTION("sequence")
+    {
+        write_all(out, std::deque{1, 2, 3});
+        CHECK(out.str() == "1 2 3 \n");
+    }
+
+    SECTION("map is not indexed")
+    {
+        const std::map<size_t, std::string> dict = {{0, "zero"}, {5, "five"}};
+        write_all(out, dict, ", ");
+        CHECK(out.str() == "0: zero, 5: five, \n");
+    }
+}
+
+namespace
+{
+    template <typename Container>
+    Container make_container(int size)
+    {
+        Container container;
+        for (int i = 0; i < size; ++i)
+        {
+            if constexpr (HasKeyType<Container> && requires { typename Container::mapped_type; })
+                container.emplace(i, i);
+            else if constexpr (HasKeyType<Container>)
+                container.insert(i);
+            else
+                container.push_back(i);
+        }
+        return container;
+    }
+
+    template <typename Container>
+    void benchmark_traversal(const std::string& name)
+    {
+        // time per item stays constant when the traversal is O(n)
+        for (int size : {1'000, 10'000, 100'000})
+        {
+            auto container = make_container<Container>(size);
+
+            BENCHMARK(name + " - " + std::to_string(size) + " items")
+            {
+                long sum = 0;
+                for_each_item(container, [&](const auto& item) {
+                    if constexpr (requires { item.second; })
+                        sum += item.second;
+                    else
+                        sum += item;
+                });
+                return sum;
+            };
+        }
+    }
+} // namespace
+
+TEST_CASE("traversal - O(n) for all containers", "[.][benchmark]")
+{
+    benchmark_traversal<std::vector<int>>("vector");
+    benchmark_traversal<std::deque<int>>("deque");
+    benchmark_traversal<std::list<int>>("list");
+    benchmark_traversal<std::set<int>>("set");
+    benchmark_traversal<std::map<int, int>>("map");
+    benchmark_traversal<std::unordered_map<int, int>>("unordered_map");
+
+    // the former strategy for anything with operator[] - a lookup per item: O(n log n)
+    for (int size : {1'000, 10'000, 100'000})
+    {
+        auto dict = make_container<std::map<int, int>>(size);
+
+        BENCHMARK("map - indexed with at(i) - " + std::to_string(size) + " items")
+        {
+            long sum = 0;
+            for (int i = 0; i < size; ++i)
+                sum += dict.at(i);
+            return sum;
+        };
+    }
+}
+
+TEST_CASE("print - single buffered write vs. item by item", "[.][benchmark]")
+{
+    std::vector<int> values(100'000);
+    std::iota(values.begin(), values.end(), 0);
+
+    BENCHMARK("operator<< for every item")
+    {
+        std::ostringstream out;
+        for (const auto& item : values)
+            out << item << " ";
+        out << "\n";
+        return out.tellp();
+    };
+
+    BENCHMARK("write_all")
+    {
+        std::ostringstream out;
+        write_all(out, values);
+        return out.tellp();
+    };
+}
@@ -1,4 +1,11 @@
+#include "call_traits.hpp"
+#include "dictionary.hpp"
+#include "interned_string.hpp"
+#include "sum.hpp"
+
+#include <algorithm>
 #include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <iostream>
 #include <string>
@@ -20,6 +27,13 @@ namespace ClassTemplates
         T1 first;
         T2 second;
 
+        // arguments of exact types are passed as CallTraits suggest - also braced initializers,
+        // which cannot be deduced: Pair<std::vector<int>, int>{{1, 2, 3}, 4}
+        Pair(param_t<T1> fst, param_t<T2> snd)
+            : first(fst)
+            , second(snd)
+        { }
+
         template <typename U1, typename U2>
         Pair(U1&& fst, U2&& snd)
             : first(std::forward<U1>(fst))
@@ -45,6 +59,11 @@ namespace ClassTemplates
     {
         T first, second;
 
+        Pair(param_t<T> fst, param_t<T> snd)
+            : first(fst)
+            , second(snd)
+        { }
+
         template <typename U1, typename U2>
         Pair(U1&& fst, U2&& snd)
             : first(std::forward<U1>(fst))
@@ -59,11 +78,12 @@ namespace ClassTemplates
         }
     };
 
-    // full specialization
+    // full specialization - strings are interned: each distinct text is allocated once
+    // and equal members are detected with a pointer compare
     template <>
     struct Pair<const char*, const char*>
     {
-        std::string first, second;
+        InternedString first, second;
 
         Pair(const char* str1, const char* str2)
             : first(str1)
@@ -74,7 +94,7 @@ namespace ClassTemplates
 
         const std::string& max_value() const
         {
-            return first < second ? second : first;
+            return first < second ? second.str() : first.str();
         }
     };
 
@@ -110,9 +130,58 @@ TEST_CASE("class templates")
 
         std::string str = "text";
         ClassTemplates::Pair<std::string, std::string> p2(str, "test");
+
+        ClassTemplates::Pair p3{"a rather long text that does not fit into SSO", "text"};
+        ClassTemplates::Pair p4{"a rather long text that does not fit into SSO", "other text"};
+        CHECK(p3.first.c_str() == p4.first.c_str()); // the same pooled string
+        CHECK(p3.max_value() == "text");
+        CHECK(p3 > p4);
+
+        ClassTemplates::Pair<std::vector<int>, int> p5{{1, 2, 3}, 4};
+        CHECK(p5.first.size() == 3);
+
+        ClassTemplates::Pair<std::vector<int>, std::vector<int>> p6{{1, 2}, {3}};
+        CHECK(p6.max_value() == std::vector{3});
     }
 }
 
+TEST_CASE("Pair of C-strings - sorting", "[.][benchmark]")
+{
+    constexpr size_t count = 1'000'000;
+
+    // a limited vocabulary of long keys - the typical shape of symbol tables & tags
+    std::vector<std::string> words;
+    for (int i = 0; i < 1000; ++i)
+        words.push_back("category/subcategory/item_" + std::to_string(i % 100) + "/" + std::to_string(i));
+
+    std::vector<std::pair<const char*, const char*>> literals;
+    literals.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+        literals.emplace_back(words[(i * 7919) % 100].c_str(), words[(i * 104729) % words.size()].c_str());
+
+    BENCHMARK("Pair<std::string, std::string>")
+    {
+        std::vector<ClassTemplates::Pair<std::string, std::string>> pairs;
+        pairs.reserve(count);
+        for (const auto& [fst, snd] : literals)
+            pairs.emplace_back(fst, snd);
+
+        std::ranges::sort(pairs);
+        return pairs.size();
+    };
+
+    BENCHMARK("Pair<const char*, const char*> - interned")
+    {
+        std::vector<ClassTemplates::Pair<const char*, const char*>> pairs;
+        pairs.reserve(count);
+        for (const auto& [fst, snd] : literals)
+            pairs.emplace_back(fst, snd);
+
+        std::ranges::sort(pairs);
+        return pairs.size();
+    };
+}
+
 ////////////////////////////////////////////////////
 
 namespace ClassTemplates
@@ -212,10 +281,11 @@ auto dependent_typename_context(int x)
     return value;
 }
 
+// accumulates in a type wide enough for many values - see SumAccumulator in sum.hpp
 template <typename Container>
-typename Container::value_type sum(const Container& container)
+SumAccumulator_t<typename Container::value_type> sum(const Container& container)
 {
-    using result_type = typename Container::value_type;
+    using result_type = SumAccumulator_t<typename Container::value_type>;
 
     result_type result{};
 
@@ -267,8 +337,7 @@ TEST_CASE("dependent names")
 ///////////////////////////////////////
 // alias templates
 
-template <typename T>
-using Dictionary = std::map<std::string, T>;
+// Dictionary<T> - see dictionary.hpp
 
 template <size_t N>
 using StringArray = std::array<std::string, N>;
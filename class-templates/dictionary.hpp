@@ -0,0 +1,200 @@
+#ifndef CLASS_TEMPLATES_DICTIONARY_HPP
+#define CLASS_TEMPLATES_DICTIONARY_HPP
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////
+// Dictionaries with heterogeneous lookup
+//
+// Transparent comparators & hashers accept const char* and std::string_view
+// keys directly - no temporary std::string is created for a lookup.
+
+struct StringHash
+{
+    using is_transparent = void;
+
+    size_t operator()(std::string_view str) const noexcept
+    {
+        return std::hash<std::string_view>{}(str);
+    }
+};
+
+template <typename T>
+using Dictionary = std::map<std::string, T, std::less<>>;
+
+template <typename T>
+using HashDictionary = std::unordered_map<std::string, T, StringHash, std::equal_to<>>;
+
+/////////////////////////////////////////////////////////////////
+// FlatMap - sorted vector of key-value pairs
+//
+// Lookups are binary searches over contiguous memory. Insertions & removals
+// shift elements - best suited for read-mostly data.
+
+template <typename Key, typename T, typename Compare = std::less<>>
+class FlatMap
+{
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using key_compare = Compare;
+    using container_type = std::vector<value_type>;
+    using iterator = typename container_type::iterator;
+    using const_iterator = typename container_type::const_iterator;
+    using size_type = size_t;
+
+    FlatMap() = default;
+
+    FlatMap(std::initializer_list<value_type> items)
+        : items_(items)
+    {
+        // the first of equivalent keys is kept - the same as for std::map
+        std::ranges::stable_sort(items_, comp_, &value_type::first);
+        auto duplicates = std::ranges::unique(items_, [this](const auto& a, const auto& b) {
+            return !comp_(a, b) && !comp_(b, a);
+        }, &value_type::first);
+        items_.erase(duplicates.begin(), duplicates.end());
+    }
+
+    size_t size() const
+    {
+        return items_.size();
+    }
+
+    bool empty() const
+    {
+        return items_.empty();
+    }
+
+    void reserve(size_t capacity)
+    {
+        items_.reserve(capacity);
+    }
+
+    template <typename K>
+    iterator find(const K& key)
+    {
+        auto it = lower_bound(key);
+        return (it != items_.end() && !comp_(key, it->first)) ? it : items_.end();
+    }
+
+    template <typename K>
+    const_iterator find(const K& key) const
+    {
+        auto it = lower_bound(key);
+        return (it != items_.end() && !comp_(key, it->first)) ? it : items_.end();
+    }
+
+    template <typename K>
+    bool contains(const K& key) const
+    {
+        return find(key) != items_.end();
+    }
+
+    template <typename K>
+    T& at(const K& key)
+    {
+        auto it = find(key);
+        if (it == items_.end())
+            throw std::out_of_range("Key not found in FlatMap");
+        return it->second;
+    }
+
+    template <typename K>
+    const T& at(const K& key) const
+    {
+        auto it = find(key);
+        if (it == items_.end())
+            throw std::out_of_range("Key not found in FlatMap");
+        return it->second;
+    }
+
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+    {
+        auto it = lower_bound(key);
+        if (it != items_.end() && !comp_(key, it->first))
+            return {it, false};
+
+        it = items_.emplace(it, std::piecewise_construct,
+            std::forward_as_tuple(std::forward<K>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+        return {it, true};
+    }
+
+    template <typename K, typename V>
+    std::pair<iterator, bool> insert_or_assign(K&& key, V&& value)
+    {
+        auto [it, inserted] = try_emplace(std::forward<K>(key), std::forward<V>(value));
+        if (!inserted)
+            it->second = std::forward<V>(value);
+        return {it, inserted};
+    }
+
+    template <typename K>
+    T& operator[](K&& key)
+    {
+        return try_emplace(std::forward<K>(key)).first->second;
+    }
+
+    template <typename K>
+    size_t erase(const K& key)
+    {
+        auto it = find(key);
+        if (it == items_.end())
+            return 0;
+
+        items_.erase(it);
+        return 1;
+    }
+
+    iterator begin()
+    {
+        return items_.begin();
+    }
+
+    iterator end()
+    {
+        return items_.end();
+    }
+
+    const_iterator begin() const
+    {
+        return items_.begin();
+    }
+
+    const_iterator end() const
+    {
+        return items_.end();
+    }
+
+private:
+    container_type items_;
+    [[no_unique_address]] Compare comp_;
+
+    template <typename K>
+    iterator lower_bound(const K& key)
+    {
+        return std::ranges::lower_bound(items_, key, comp_, &value_type::first);
+    }
+
+    template <typename K>
+    const_iterator lower_bound(const K& key) const
+    {
+        return std::ranges::lower_bound(items_, key, comp_, &value_type::first);
+    }
+};
+
+template <typename T>
+using FlatDictionary = FlatMap<std::string, T>;
+
+#endif // CLASS_TEMPLATES_DICTIONARY_HPP
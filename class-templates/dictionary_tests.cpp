@@ -0,0 +1,132 @@
+#include "dictionary.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std::literals;
+
+TEST_CASE("Dictionary - heterogeneous lookup")
+{
+    Dictionary<int> dict = {{"one", 1}, {"two", 2}};
+
+    CHECK(dict.find("one")->second == 1);
+    CHECK(dict.find("two"sv)->second == 2);
+    CHECK(dict.contains("two"sv));
+    CHECK(!dict.contains("three"));
+}
+
+TEST_CASE("HashDictionary - heterogeneous lookup")
+{
+    HashDictionary<int> dict = {{"one", 1}, {"two", 2}};
+
+    CHECK(dict.find("one")->second == 1);
+    CHECK(dict.find("two"sv)->second == 2);
+    CHECK(dict.contains("two"sv));
+    CHECK(!dict.contains("three"));
+}
+
+TEST_CASE("FlatDictionary")
+{
+    FlatDictionary<int> dict = {{"two", 2}, {"one", 1}, {"three", 3}, {"one", 665}};
+
+    SECTION("items are sorted & unique")
+    {
+        REQUIRE(dict.size() == 3);
+
+        std::vector<std::string> keys;
+        for (const auto& [key, value] : dict)
+            keys.push_back(key);
+
+        CHECK(keys == std::vector{"one"s, "three"s, "two"s});
+        CHECK(dict.at("one") == 1);
+    }
+
+    SECTION("lookup with string_view")
+    {
+        CHECK(dict.find("three"sv)->second == 3);
+        CHECK(dict.find("four"sv) == dict.end());
+        CHECK(dict.contains("two"));
+        CHECK_THROWS_AS(dict.at("four"sv), std::out_of_range);
+    }
+
+    SECTION("insertion keeps order")
+    {
+        dict["four"] = 4;
+        auto [it, inserted] = dict.try_emplace("zero"s, 0);
+        CHECK(inserted);
+
+        auto [it_one, inserted_one] = dict.insert_or_assign("one", 11);
+        CHECK(!inserted_one);
+        CHECK(it_one->second == 11);
+
+        CHECK(std::ranges::is_sorted(dict, std::less<>{}, &FlatDictionary<int>::value_type::first));
+        CHECK(dict.size() == 5);
+    }
+
+    SECTION("erase")
+    {
+        CHECK(dict.erase("two"sv) == 1);
+        CHECK(dict.erase("two"sv) == 0);
+        CHECK(dict.size() == 2);
+    }
+}
+
+TEST_CASE("Dictionary - lookup with string_view keys", "[.][benchmark]")
+{
+    constexpr int key_count = 1000;
+
+    std::vector<std::string> keys;
+    for (int i = 0; i < key_count; ++i)
+        keys.push_back("configuration.section.key_number_" + std::to_string(i));
+
+    std::map<std::string, int> std_map;
+    Dictionary<int> dict;
+    HashDictionary<int> hash_dict;
+    FlatDictionary<int> flat_dict;
+
+    for (int i = 0; i < key_count; ++i)
+    {
+        std_map.emplace(keys[i], i);
+        dict.emplace(keys[i], i);
+        hash_dict.emplace(keys[i], i);
+        flat_dict.try_emplace(keys[i], i);
+    }
+
+    std::vector<std::string_view> lookups(keys.begin(), keys.end());
+
+    BENCHMARK("std::map<std::string, T> - temporary std::string")
+    {
+        long sum = 0;
+        for (auto key : lookups)
+            sum += std_map.find(std::string{key})->second;
+        return sum;
+    };
+
+    BENCHMARK("Dictionary - std::less<>")
+    {
+        long sum = 0;
+        for (auto key : lookups)
+            sum += dict.find(key)->second;
+        return sum;
+    };
+
+    BENCHMARK("HashDictionary - transparent hash")
+    {
+        long sum = 0;
+        for (auto key : lookups)
+            sum += hash_dict.find(key)->second;
+        return sum;
+    };
+
+    BENCHMARK("FlatDictionary - sorted vector")
+    {
+        long sum = 0;
+        for (auto key : lookups)
+            sum += flat_dict.find(key)->second;
+        return sum;
+    };
+}
@@ -0,0 +1,729 @@
+#ifndef CLASS_TEMPLATES_FLAT_HASH_MAP_HPP
+#define CLASS_TEMPLATES_FLAT_HASH_MAP_HPP
+
+#include "dictionary.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FLAT_HASH_MAP_SSE2 1
+#endif
+
+/////////////////////////////////////////////////////////////////
+// FlatHashMap - open addressing hash map with SwissTable-like metadata
+//
+// Every slot has a control byte: empty, deleted or 7 low bits of the hash (H2).
+// Control bytes are scanned in groups of 16 (one SSE2 compare per group), so
+// most probes touch key-value slots only for true candidates.
+// Slots are stored in one contiguous array - no allocation per element.
+//
+// As in FlatMap, value_type is std::pair<Key, T> - keys must not be modified
+// through iterators.
+
+namespace FlatHashMapDetail
+{
+    using ctrl_t = int8_t;
+
+    constexpr ctrl_t empty = -128;  // 0b10000000
+    constexpr ctrl_t deleted = -2;  // 0b11111110
+    constexpr ctrl_t sentinel = -1; // 0b11111111 - marks end of control bytes for iterators
+
+    constexpr bool is_full(ctrl_t ctrl)
+    {
+        return ctrl >= 0;
+    }
+
+    // bits of the mask correspond to matching positions in a group
+    class BitMask
+    {
+        uint32_t mask_;
+
+    public:
+        explicit BitMask(uint32_t mask)
+            : mask_{mask}
+        { }
+
+        explicit operator bool() const
+        {
+            return mask_ != 0;
+        }
+
+        size_t lowest() const
+        {
+            return static_cast<size_t>(std::countr_zero(mask_));
+        }
+
+        void clear_lowest()
+        {
+            mask_ &= mask_ - 1;
+        }
+    };
+
+    struct Group
+    {
+        static constexpr size_t width = 16;
+
+#ifdef FLAT_HASH_MAP_SSE2
+        __m128i ctrl;
+
+        explicit Group(const ctrl_t* pos)
+            : ctrl{_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos))}
+        { }
+
+        BitMask match(ctrl_t h2) const
+        {
+            return BitMask{static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl)))};
+        }
+
+        BitMask match_empty() const
+        {
+            return match(empty);
+        }
+
+        BitMask match_empty_or_deleted() const
+        {
+            // empty & deleted are the only values less than sentinel
+            return BitMask{static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(sentinel), ctrl)))};
+        }
+#else
+        const ctrl_t* ctrl;
+
+        explicit Group(const ctrl_t* pos)
+            : ctrl{pos}
+        { }
+
+        template <typename Predicate>
+        BitMask match_if(Predicate pred) const
+        {
+            uint32_t mask = 0;
+            for (size_t i = 0; i < width; ++i)
+                mask |= static_cast<uint32_t>(pred(ctrl[i])) << i;
+            return BitMask{mask};
+        }
+
+        BitMask match(ctrl_t h2) const
+        {
+            return match_if([h2](ctrl_t c) { return c == h2; });
+        }
+
+        BitMask match_empty() const
+        {
+            return match(empty);
+        }
+
+        BitMask match_empty_or_deleted() const
+        {
+            return match_if([](ctrl_t c) { return c < sentinel; });
+        }
+#endif
+    };
+
+    // spreads entropy of weak hashes (e.g. identity hash of integers) over all bits
+    constexpr uint64_t mix(uint64_t hash)
+    {
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 33;
+        return hash;
+    }
+} // namespace FlatHashMapDetail
+
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class FlatHashMap
+{
+    using ctrl_t = FlatHashMapDetail::ctrl_t;
+    using Group = FlatHashMapDetail::Group;
+
+    static constexpr bool TransparentLookup = requires {
+        typename Hash::is_transparent;
+        typename KeyEqual::is_transparent;
+    };
+
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using size_type = size_t;
+
+private:
+    union Slot
+    {
+        value_type value;
+
+        Slot() { }
+        ~Slot() { }
+    };
+
+    template <bool IsConst>
+    class Iterator
+    {
+        friend class FlatHashMap;
+        template <bool>
+        friend class Iterator;
+
+        const ctrl_t* ctrl_{};
+        std::conditional_t<IsConst, const Slot*, Slot*> slot_{};
+
+        Iterator(const ctrl_t* ctrl, decltype(slot_) slot)
+            : ctrl_{ctrl}
+            , slot_{slot}
+        {
+            skip_empty_slots();
+        }
+
+        void skip_empty_slots()
+        {
+            while (*ctrl_ < FlatHashMapDetail::sentinel)
+            {
+                ++ctrl_;
+                ++slot_;
+            }
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = FlatHashMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+        using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+
+        Iterator() = default;
+
+        operator Iterator<true>() const
+            requires(!IsConst)
+        {
+            Iterator<true> it;
+            it.ctrl_ = ctrl_;
+            it.slot_ = slot_;
+            return it;
+        }
+
+        reference operator*() const
+        {
+            return slot_->value;
+        }
+
+        pointer operator->() const
+        {
+            return &slot_->value;
+        }
+
+        Iterator& operator++()
+        {
+            ++ctrl_;
+            ++slot_;
+            skip_empty_slots();
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator temp{*this};
+            ++*this;
+            return temp;
+        }
+
+        bool operator==(const Iterator& other) const
+        {
+            return ctrl_ == other.ctrl_;
+        }
+    };
+
+public:
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    FlatHashMap() = default;
+
+    FlatHashMap(std::initializer_list<value_type> items)
+    {
+        reserve(items.size());
+        for (const auto& item : items)
+            insert(item);
+    }
+
+    FlatHashMap(const FlatHashMap& other)
+        : hash_{other.hash_}
+        , eq_{other.eq_}
+    {
+        reserve(other.size());
+        for (const auto& item : other)
+            insert(item);
+    }
+
+    FlatHashMap(FlatHashMap&& other) noexcept
+        : ctrl_{std::move(other.ctrl_)}
+        , slots_{std::move(other.slots_)}
+        , capacity_{std::exchange(other.capacity_, 0)}
+        , size_{std::exchange(other.size_, 0)}
+        , growth_left_{std::exchange(other.growth_left_, 0)}
+        , hash_{std::move(other.hash_)}
+        , eq_{std::move(other.eq_)}
+    { }
+
+    FlatHashMap& operator=(const FlatHashMap& other)
+    {
+        if (this != &other)
+        {
+            FlatHashMap temp(other);
+            swap(temp);
+        }
+        return *this;
+    }
+
+    FlatHashMap& operator=(FlatHashMap&& other) noexcept
+    {
+        if (this != &other)
+        {
+            FlatHashMap temp(std::move(other));
+            swap(temp);
+        }
+        return *this;
+    }
+
+    ~FlatHashMap()
+    {
+        destroy_slots();
+    }
+
+    void swap(FlatHashMap& other) noexcept
+    {
+        std::swap(ctrl_, other.ctrl_);
+        std::swap(slots_, other.slots_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(size_, other.size_);
+        std::swap(growth_left_, other.growth_left_);
+        std::swap(hash_, other.hash_);
+        std::swap(eq_, other.eq_);
+    }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    size_t capacity() const
+    {
+        return capacity_;
+    }
+
+    void clear()
+    {
+        destroy_slots();
+        if (capacity_ > 0)
+            reset_ctrl();
+        size_ = 0;
+        growth_left_ = max_load(capacity_);
+    }
+
+    void reserve(size_t count)
+    {
+        size_t required = Group::width;
+        while (max_load(required) < count)
+            required *= 2;
+
+        if (required > capacity_)
+            rehash(required);
+    }
+
+    /////////////////////////////////////////////////////////////////
+    // lookup - heterogeneous when both Hash & KeyEqual are transparent,
+    // otherwise the key is converted to Key as in std::unordered_map
+
+    iterator find(const Key& key)
+    {
+        return iterator_or_end(find_index(key));
+    }
+
+    template <typename K>
+        requires TransparentLookup
+    iterator find(const K& key)
+    {
+        return iterator_or_end(find_index(key));
+    }
+
+    const_iterator find(const Key& key) const
+    {
+        return iterator_or_end(find_index(key));
+    }
+
+    template <typename K>
+        requires TransparentLookup
+    const_iterator find(const K& key) const
+    {
+        return iterator_or_end(find_index(key));
+    }
+
+    bool contains(const Key& key) const
+    {
+        return find_index(key) != npos;
+    }
+
+    template <typename K>
+        requires TransparentLookup
+    bool contains(const K& key) const
+    {
+        return find_index(key) != npos;
+    }
+
+    T& at(const Key& key)
+    {
+        return slots_[checked_index(find_index(key))].value.second;
+    }
+
+    template <typename K>
+        requires TransparentLookup
+    T& at(const K& key)
+    {
+        return slots_[checked_index(find_index(key))].value.second;
+    }
+
+    const T& at(const Key& key) const
+    {
+        return slots_[checked_index(find_index(key))].value.second;
+    }
+
+    template <typename K>
+        requires TransparentLookup
+    const T& at(const K& key) const
+    {
+        return slots_[checked_index(find_index(key))].value.second;
+    }
+
+    /////////////////////////////////////////////////////////////////
+    // modifiers
+
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+    {
+        if constexpr (!TransparentLookup && !std::is_same_v<std::remove_cvref_t<K>, Key>)
+        {
+            return try_emplace(Key(std::forward<K>(key)), std::forward<Args>(args)...);
+        }
+        else
+        {
+            const uint64_t hash = hash_of(key);
+
+            if (size_t index = find_index(key, hash); index != npos)
+                return {iterator_at(index), false};
+
+            size_t index = prepare_insert(hash);
+            std::construct_at(&slots_[index].value, std::piecewise_construct,
+                std::forward_as_tuple(std::forward<K>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+            set_ctrl(index, h2(hash));
+            ++size_;
+
+            return {iterator_at(index), true};
+        }
+    }
+
+    // the key must be known before a slot is chosen - arguments other than a key & a value
+    // (e.g. std::piecewise_construct) build a temporary pair
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        if constexpr (sizeof...(Args) == 2)
+            return try_emplace(std::forward<Args>(args)...);
+        else
+            return insert(value_type(std::forward<Args>(args)...));
+    }
+
+    std::pair<iterator, bool> insert(const value_type& item)
+    {
+        return try_emplace(item.first, item.second);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& item)
+    {
+        return try_emplace(std::move(item.first), std::move(item.second));
+    }
+
+    template <typename K, typename V>
+    std::pair<iterator, bool> insert_or_assign(K&& key, V&& value)
+    {
+        auto [it, inserted] = try_emplace(std::forward<K>(key), std::forward<V>(value));
+        if (!inserted)
+            it->second = std::forward<V>(value);
+        return {it, inserted};
+    }
+
+    T& operator[](const Key& key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    T& operator[](Key&& key)
+    {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    size_t erase(const Key& key)
+    {
+        return erase_index(find_index(key));
+    }
+
+    template <typename K>
+        requires TransparentLookup
+    size_t erase(const K& key)
+    {
+        return erase_index(find_index(key));
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        size_t index = static_cast<size_t>(pos.ctrl_ - ctrl_.get());
+        erase_at(index);
+        return iterator_at(index + 1);
+    }
+
+    /////////////////////////////////////////////////////////////////
+    // iteration
+
+    iterator begin()
+    {
+        return capacity_ == 0 ? end() : iterator_at(0);
+    }
+
+    iterator end()
+    {
+        return capacity_ == 0 ? iterator{&empty_ctrl, nullptr} : iterator{ctrl_.get() + capacity_, slots_.get() + capacity_};
+    }
+
+    const_iterator begin() const
+    {
+        return capacity_ == 0 ? end() : iterator_at(0);
+    }
+
+    const_iterator end() const
+    {
+        return capacity_ == 0 ? const_iterator{&empty_ctrl, nullptr} : const_iterator{ctrl_.get() + capacity_, slots_.get() + capacity_};
+    }
+
+private:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+    static constexpr size_t next_group = npos - 1; // probe result: continue with the next group
+    static constexpr ctrl_t empty_ctrl = FlatHashMapDetail::sentinel;
+
+    std::unique_ptr<ctrl_t[]> ctrl_; // capacity_ control bytes + sentinel
+    std::unique_ptr<Slot[]> slots_;
+    size_t capacity_ = 0; // power of 2 & multiple of Group::width
+    size_t size_ = 0;
+    size_t growth_left_ = 0; // empty slots that can be used before rehash
+    [[no_unique_address]] Hash hash_;
+    [[no_unique_address]] KeyEqual eq_;
+
+    // empty table of the given capacity - used by rehash
+    FlatHashMap(size_t capacity, const Hash& hash, const KeyEqual& eq)
+        : hash_{hash}
+        , eq_{eq}
+    {
+        ctrl_ = std::make_unique<ctrl_t[]>(capacity + 1);
+        slots_ = std::make_unique<Slot[]>(capacity);
+        capacity_ = capacity;
+        growth_left_ = max_load(capacity);
+        reset_ctrl();
+    }
+
+    static constexpr size_t max_load(size_t capacity)
+    {
+        return capacity - capacity / 8; // load factor 7/8
+    }
+
+    static constexpr ctrl_t h2(uint64_t hash)
+    {
+        return static_cast<ctrl_t>(hash & 0x7F);
+    }
+
+    static constexpr uint64_t h1(uint64_t hash)
+    {
+        return hash >> 7;
+    }
+
+    template <typename K>
+    uint64_t hash_of(const K& key) const
+    {
+        return FlatHashMapDetail::mix(static_cast<uint64_t>(hash_(key)));
+    }
+
+    // triangular probing over groups visits every group when their number is a power of 2
+    template <typename F>
+    size_t probe(uint64_t hash, F on_group) const
+    {
+        const size_t group_mask = capacity_ / Group::width - 1;
+        size_t group = h1(hash) & group_mask;
+
+        for (size_t step = 1;; ++step)
+        {
+            if (size_t result = on_group(group * Group::width, Group{ctrl_.get() + group * Group::width}); result != next_group)
+                return result;
+
+            group = (group + step) & group_mask;
+        }
+    }
+
+    template <typename K>
+    size_t find_index(const K& key) const
+    {
+        return capacity_ == 0 ? npos : find_index(key, hash_of(key));
+    }
+
+    template <typename K>
+    size_t find_index(const K& key, uint64_t hash) const
+    {
+        if (capacity_ == 0)
+            return npos;
+
+        return probe(hash, [&](size_t offset, const Group& group) {
+            for (auto candidates = group.match(h2(hash)); candidates; candidates.clear_lowest())
+            {
+                size_t index = offset + candidates.lowest();
+                if (eq_(slots_[index].value.first, key))
+                    return index;
+            }
+
+            // an empty slot ends the probe sequence - the key would have been stored there
+            return group.match_empty() ? npos : next_group;
+        });
+    }
+
+    size_t find_insert_slot(uint64_t hash) const
+    {
+        return probe(hash, [](size_t offset, const Group& group) {
+            auto free_slots = group.match_empty_or_deleted();
+            return free_slots ? offset + free_slots.lowest() : next_group;
+        });
+    }
+
+    size_t prepare_insert(uint64_t hash)
+    {
+        if (capacity_ == 0)
+            rehash(Group::width);
+
+        size_t index = find_insert_slot(hash);
+
+        if (growth_left_ == 0 && ctrl_[index] == FlatHashMapDetail::empty)
+        {
+            // many tombstones - rehash in place, otherwise grow
+            rehash(size_ * 2 < max_load(capacity_) ? capacity_ : capacity_ * 2);
+            index = find_insert_slot(hash);
+        }
+
+        if (ctrl_[index] == FlatHashMapDetail::empty)
+            --growth_left_;
+
+        return index;
+    }
+
+    void set_ctrl(size_t index, ctrl_t value)
+    {
+        ctrl_[index] = value;
+    }
+
+    void erase_at(size_t index)
+    {
+        std::destroy_at(&slots_[index].value);
+        set_ctrl(index, FlatHashMapDetail::deleted);
+        --size_;
+    }
+
+    void reset_ctrl()
+    {
+        std::memset(ctrl_.get(), static_cast<unsigned char>(FlatHashMapDetail::empty), capacity_);
+        ctrl_[capacity_] = FlatHashMapDetail::sentinel;
+    }
+
+    // items are moved to a new table that replaces this one only when complete -
+    // if an allocation or a copy (for items without noexcept move) throws, the map is left unchanged
+    void rehash(size_t new_capacity)
+    {
+        FlatHashMap resized(new_capacity, hash_, eq_);
+
+        for (size_t i = 0; i < capacity_; ++i)
+        {
+            if (!FlatHashMapDetail::is_full(ctrl_[i]))
+                continue;
+
+            value_type& item = slots_[i].value;
+            const uint64_t hash = resized.hash_of(item.first);
+            size_t index = resized.find_insert_slot(hash);
+
+            std::construct_at(&resized.slots_[index].value, std::move_if_noexcept(item));
+            resized.set_ctrl(index, h2(hash));
+            --resized.growth_left_;
+            ++resized.size_;
+        }
+
+        // resized takes the old table - its destructor destroys the moved-from items
+        swap(resized);
+    }
+
+    void destroy_slots()
+    {
+        if constexpr (!std::is_trivially_destructible_v<value_type>)
+        {
+            for (size_t i = 0; i < capacity_; ++i)
+                if (FlatHashMapDetail::is_full(ctrl_[i]))
+                    std::destroy_at(&slots_[i].value);
+        }
+    }
+
+    size_t checked_index(size_t index) const
+    {
+        if (index == npos)
+            throw std::out_of_range("Key not found in FlatHashMap");
+        return index;
+    }
+
+    size_t erase_index(size_t index)
+    {
+        if (index == npos)
+            return 0;
+
+        erase_at(index);
+        return 1;
+    }
+
+    iterator iterator_or_end(size_t index)
+    {
+        return index == npos ? end() : iterator_at(index);
+    }
+
+    const_iterator iterator_or_end(size_t index) const
+    {
+        return index == npos ? end() : iterator_at(index);
+    }
+
+    iterator iterator_at(size_t index)
+    {
+        return iterator{ctrl_.get() + index, slots_.get() + index};
+    }
+
+    const_iterator iterator_at(size_t index) const
+    {
+        return const_iterator{ctrl_.get() + index, slots_.get() + index};
+    }
+};
+
+template <typename T>
+using FlatHashDictionary = FlatHashMap<std::string, T, StringHash, std::equal_to<>>;
+
+#endif // CLASS_TEMPLATES_FLAT_HASH_MAP_HPP
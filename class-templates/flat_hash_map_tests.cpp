@@ -0,0 +1,285 @@
+#include "flat_hash_map.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    // every key lands in the same group with the same H2 - worst case for probing
+    struct ConstantHash
+    {
+        size_t operator()(int) const
+        {
+            return 42;
+        }
+    };
+} // namespace
+
+TEST_CASE("FlatHashMap - basic operations")
+{
+    FlatHashMap<int, std::string> map;
+
+    REQUIRE(map.empty());
+    CHECK(map.find(1) == map.end());
+    CHECK(map.begin() == map.end());
+
+    SECTION("insert & find")
+    {
+        auto [it, inserted] = map.try_emplace(1, "one");
+        CHECK(inserted);
+        CHECK(it->second == "one");
+
+        auto [it_dup, inserted_dup] = map.insert({1, "uno"});
+        CHECK(!inserted_dup);
+        CHECK(it_dup->second == "one");
+
+        map[2] = "two";
+        CHECK(map.size() == 2);
+        CHECK(map.at(2) == "two");
+        CHECK(map.contains(1));
+        CHECK(!map.contains(3));
+        CHECK_THROWS_AS(map.at(3), std::out_of_range);
+    }
+
+    SECTION("growth keeps all items")
+    {
+        for (int i = 0; i < 10'000; ++i)
+            map[i] = std::to_string(i);
+
+        CHECK(map.size() == 10'000);
+        CHECK(map.capacity() >= 10'000);
+
+        for (int i = 0; i < 10'000; ++i)
+            REQUIRE(map.at(i) == std::to_string(i));
+
+        CHECK(std::distance(map.begin(), map.end()) == 10'000);
+    }
+
+    SECTION("erase")
+    {
+        for (int i = 0; i < 100; ++i)
+            map[i] = std::to_string(i);
+
+        for (int i = 0; i < 100; i += 2)
+            CHECK(map.erase(i) == 1);
+
+        CHECK(map.erase(0) == 0);
+        CHECK(map.size() == 50);
+
+        for (int i = 0; i < 100; ++i)
+            CHECK(map.contains(i) == (i % 2 == 1));
+    }
+
+    SECTION("repeated insert & erase reuses deleted slots")
+    {
+        for (int i = 0; i < 100'000; ++i)
+        {
+            map[i] = "x";
+            map.erase(i);
+        }
+
+        CHECK(map.empty());
+        CHECK(map.capacity() <= 64);
+    }
+
+    SECTION("erase while iterating")
+    {
+        for (int i = 0; i < 100; ++i)
+            map[i] = std::to_string(i);
+
+        for (auto it = map.begin(); it != map.end();)
+        {
+            if (it->first % 3 == 0)
+                it = map.erase(it);
+            else
+                ++it;
+        }
+
+        CHECK(map.size() == 66);
+    }
+}
+
+TEST_CASE("FlatHashMap - keys converted to Key")
+{
+    FlatHashMap<std::string, int> words;
+    words.emplace("one", 1);
+    words.emplace(std::piecewise_construct, std::forward_as_tuple("two"), std::forward_as_tuple(2));
+    words.emplace(std::pair{"three"s, 3});
+
+    CHECK(words.contains("one"));
+    CHECK(words.find("two")->second == 2);
+    CHECK(words.at("three") == 3);
+
+    FlatHashMap<int64_t, int> numbers = {{1, 10}, {2, 20}};
+    int key = 2;
+    CHECK(numbers.find(key)->second == 20);
+    CHECK(numbers.contains(1));
+    CHECK(numbers.erase(key) == 1);
+    CHECK(!numbers.contains(2));
+
+    auto [it, inserted] = numbers.emplace(3, 30);
+    CHECK(inserted);
+    CHECK(it->second == 30);
+    CHECK(!numbers.emplace(3, 31).second);
+}
+
+namespace
+{
+    // copying throws once the budget is used up - a move may throw too, so rehash copies
+    struct ThrowingCopy
+    {
+        inline static int copies_left = 1'000'000;
+        int value;
+
+        ThrowingCopy(int v)
+            : value{v}
+        { }
+
+        ThrowingCopy(const ThrowingCopy& other)
+            : value{other.value}
+        {
+            if (copies_left-- == 0)
+                throw std::runtime_error("copy failed");
+        }
+    };
+} // namespace
+
+TEST_CASE("FlatHashMap - rehash is exception safe")
+{
+    FlatHashMap<int, ThrowingCopy> map;
+    for (int i = 0; i < 14; ++i) // max load of the first group
+        map.try_emplace(i, i);
+    REQUIRE(map.capacity() == 16);
+
+    ThrowingCopy::copies_left = 5;
+    CHECK_THROWS_AS(map.try_emplace(100, 100), std::runtime_error);
+    ThrowingCopy::copies_left = 1'000'000;
+
+    CHECK(map.size() == 14);
+    CHECK(map.capacity() == 16);
+    for (int i = 0; i < 14; ++i)
+        REQUIRE(map.at(i).value == i);
+
+    map.try_emplace(100, 100);
+    CHECK(map.size() == 15);
+    CHECK(map.at(100).value == 100);
+}
+
+TEST_CASE("FlatHashMap - collisions")
+{
+    FlatHashMap<int, int, ConstantHash> map;
+
+    for (int i = 0; i < 100; ++i)
+        map[i] = i * i;
+
+    for (int i = 0; i < 100; ++i)
+        REQUIRE(map.at(i) == i * i);
+
+    map.erase(50);
+    CHECK(!map.contains(50));
+    CHECK(map.at(99) == 99 * 99);
+}
+
+TEST_CASE("FlatHashMap - copy & move")
+{
+    FlatHashMap<std::string, std::unique_ptr<int>> map;
+    map.try_emplace("one", std::make_unique<int>(1));
+    map.try_emplace("two", std::make_unique<int>(2));
+
+    auto moved = std::move(map);
+    CHECK(moved.size() == 2);
+    CHECK(*moved.at("two"s) == 2);
+    CHECK(map.empty());
+
+    FlatHashMap<std::string, int> original = {{"one", 1}, {"two", 2}};
+    FlatHashMap<std::string, int> copy = original;
+    copy["three"] = 3;
+
+    CHECK(original.size() == 2);
+    CHECK(copy.size() == 3);
+}
+
+TEST_CASE("FlatHashDictionary - heterogeneous lookup")
+{
+    FlatHashDictionary<int> dict = {{"one", 1}, {"two", 2}};
+
+    CHECK(dict.find("one"sv)->second == 1);
+    CHECK(dict.contains("two"));
+    CHECK(!dict.contains("three"sv));
+
+    dict.try_emplace("three"sv, 3);
+    CHECK(dict.at("three") == 3);
+}
+
+namespace
+{
+    template <typename Map>
+    void benchmark_map(const std::string& name, const std::vector<std::string>& keys, const std::vector<std::string>& missing)
+    {
+        BENCHMARK(name + " - insert")
+        {
+            Map map;
+            for (size_t i = 0; i < keys.size(); ++i)
+                map.emplace(keys[i], static_cast<int>(i));
+            return map.size();
+        };
+
+        Map map;
+        for (size_t i = 0; i < keys.size(); ++i)
+            map.emplace(keys[i], static_cast<int>(i));
+
+        BENCHMARK(name + " - hit lookup")
+        {
+            long sum = 0;
+            for (const auto& key : keys)
+                sum += map.find(key)->second;
+            return sum;
+        };
+
+        BENCHMARK(name + " - miss lookup")
+        {
+            size_t count = 0;
+            for (const auto& key : missing)
+                count += map.find(key) == map.end();
+            return count;
+        };
+
+        BENCHMARK(name + " - iteration")
+        {
+            long sum = 0;
+            for (const auto& [key, value] : map)
+                sum += value;
+            return sum;
+        };
+    }
+
+} // namespace
+
+TEST_CASE("FlatHashMap vs. std::map & std::unordered_map", "[.][benchmark]")
+{
+    constexpr int key_count = 100'000;
+
+    std::vector<std::string> keys, missing;
+    for (int i = 0; i < key_count; ++i)
+    {
+        keys.push_back("symbol_" + std::to_string(i));
+        missing.push_back("missing_" + std::to_string(i));
+    }
+
+    benchmark_map<std::map<std::string, int>>("std::map", keys, missing);
+    benchmark_map<std::unordered_map<std::string, int>>("std::unordered_map", keys, missing);
+    benchmark_map<FlatHashDictionary<int>>("FlatHashMap", keys, missing);
+}
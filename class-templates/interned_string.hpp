@@ -0,0 +1,147 @@
+#ifndef CLASS_TEMPLATES_INTERNED_STRING_HPP
+#define CLASS_TEMPLATES_INTERNED_STRING_HPP
+
+#include "dictionary.hpp"
+
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+/////////////////////////////////////////////////////////////////
+// InternedString - handle to a string stored once in a StringPool
+//
+// Every distinct text is allocated only once. Two handles are equal exactly
+// when they point to the same pooled string, so equality is a pointer compare.
+// Ordering stays lexicographic - it compares texts only for different strings.
+
+class InternedString
+{
+    inline static const std::string empty_{};
+
+    const std::string* str_ = &empty_;
+
+    explicit InternedString(const std::string* str)
+        : str_{str}
+    { }
+
+    friend class StringPool;
+
+public:
+    InternedString() = default;
+
+    // interns the text in the global pool
+    InternedString(std::string_view text);
+
+    InternedString(const char* text)
+        : InternedString{std::string_view{text}}
+    { }
+
+    const std::string& str() const
+    {
+        return *str_;
+    }
+
+    std::string_view view() const
+    {
+        return *str_;
+    }
+
+    const char* c_str() const
+    {
+        return str_->c_str();
+    }
+
+    size_t size() const
+    {
+        return str_->size();
+    }
+
+    bool empty() const
+    {
+        return str_->empty();
+    }
+
+    bool operator==(const InternedString& other) const
+    {
+        return str_ == other.str_;
+    }
+
+    std::strong_ordering operator<=>(const InternedString& other) const
+    {
+        if (str_ == other.str_)
+            return std::strong_ordering::equal;
+
+        return *str_ <=> *other.str_;
+    }
+
+    friend std::ostream& operator<<(std::ostream& out, const InternedString& str)
+    {
+        return out << str.view();
+    }
+
+    friend struct std::hash<InternedString>;
+};
+
+/////////////////////////////////////////////////////////////////
+// StringPool - owner of interned strings
+//
+// Nodes of std::unordered_set are never relocated, so handles stay valid
+// for the lifetime of the pool. Interning is thread-safe. Handles from
+// different pools must not be compared with each other.
+
+class StringPool
+{
+    mutable std::mutex mtx_;
+    std::unordered_set<std::string, StringHash, std::equal_to<>> strings_;
+
+public:
+    StringPool() = default;
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    static StringPool& global()
+    {
+        static StringPool pool;
+        return pool;
+    }
+
+    InternedString intern(std::string_view text)
+    {
+        if (text.empty())
+            return InternedString{};
+
+        std::lock_guard lk{mtx_};
+
+        auto it = strings_.find(text);
+        if (it == strings_.end())
+            it = strings_.emplace(text).first;
+
+        return InternedString{&*it};
+    }
+
+    size_t size() const
+    {
+        std::lock_guard lk{mtx_};
+        return strings_.size();
+    }
+};
+
+inline InternedString::InternedString(std::string_view text)
+    : InternedString{StringPool::global().intern(text)}
+{ }
+
+template <>
+struct std::hash<InternedString>
+{
+    size_t operator()(const InternedString& str) const noexcept
+    {
+        return std::hash<const std::string*>{}(str.str_);
+    }
+};
+
+#endif // CLASS_TEMPLATES_INTERNED_STRING_HPP
@@ -0,0 +1,79 @@
+#include "interned_string.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+using namespace std::literals;
+
+TEST_CASE("InternedString")
+{
+    SECTION("equal texts share storage")
+    {
+        std::string text = "interned text that is longer than SSO buffer";
+
+        InternedString str1 = text.c_str();
+        InternedString str2 = std::string_view{text};
+
+        CHECK(str1 == str2);
+        CHECK(str1.c_str() == str2.c_str());
+        CHECK(str1.view() == text);
+    }
+
+    SECTION("ordering is lexicographic")
+    {
+        InternedString a = "apple";
+        InternedString b = "banana";
+
+        CHECK(a < b);
+        CHECK(a != b);
+        CHECK((a <=> InternedString{"apple"}) == std::strong_ordering::equal);
+    }
+
+    SECTION("empty string")
+    {
+        InternedString empty;
+        CHECK(empty.empty());
+        CHECK(empty == InternedString{""});
+    }
+
+    SECTION("hashing")
+    {
+        std::unordered_set<InternedString> set = {"one", "two", "one"};
+        CHECK(set.size() == 2);
+        CHECK(set.contains("two"));
+    }
+}
+
+TEST_CASE("StringPool")
+{
+    StringPool pool;
+
+    auto str1 = pool.intern("text");
+    auto str2 = pool.intern("text"s);
+    auto str3 = pool.intern("other");
+
+    CHECK(str1 == str2);
+    CHECK(str1 != str3);
+    CHECK(pool.size() == 2);
+
+    SECTION("concurrent interning")
+    {
+        std::vector<InternedString> results(4);
+        {
+            std::vector<std::jthread> threads;
+            for (auto& result : results)
+                threads.emplace_back([&] {
+                    for (int i = 0; i < 1000; ++i)
+                        pool.intern("item_" + std::to_string(i));
+                    result = pool.intern("item_42");
+                });
+        }
+
+        CHECK(pool.size() == 1002);
+        for (const auto& result : results)
+            CHECK(result == results.front());
+    }
+}
@@ -0,0 +1,405 @@
+#ifndef CLASS_TEMPLATES_SIMD_ARRAY_HPP
+#define CLASS_TEMPLATES_SIMD_ARRAY_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+/////////////////////////////////////////////////////////////////
+// SimdArray - fixed-size array with vectorizable element-wise math
+//
+// Arithmetic operators build expression templates instead of temporaries:
+// c = a * k + b evaluates in one loop over aligned storage, which the compiler
+// turns into vector instructions for arithmetic T.
+//
+// Reductions accumulate into several independent lanes, so floating point sums
+// vectorize without -ffast-math. The result may differ from a sequential sum
+// in the last bits.
+
+namespace ClassTemplates
+{
+    namespace SimdDetail
+    {
+        struct ExpressionTag
+        { };
+
+        // alignment of the whole array rounded up to a power of 2, at most a cache line
+        template <typename T, size_t N>
+        constexpr size_t alignment()
+        {
+            if constexpr (std::is_arithmetic_v<T>)
+                return std::clamp(std::bit_ceil(sizeof(T) * N), alignof(T), size_t{64});
+            else
+                return alignof(T);
+        }
+
+        // number of independent accumulators used by reductions - one 256-bit register
+        template <typename T, size_t N>
+        constexpr size_t lanes()
+        {
+            if constexpr (std::is_arithmetic_v<T>)
+                return std::clamp(32 / sizeof(T), size_t{1}, N);
+            else
+                return 1;
+        }
+    } // namespace SimdDetail
+
+    template <typename E>
+    concept ArrayExpression = std::derived_from<std::remove_cvref_t<E>, SimdDetail::ExpressionTag>;
+
+    template <typename T, size_t N>
+    class SimdArray;
+
+    template <typename T>
+    constexpr bool IsSimdArray_v = false;
+
+    template <typename T, size_t N>
+    constexpr bool IsSimdArray_v<SimdArray<T, N>> = true;
+
+    namespace SimdDetail
+    {
+        // arrays passed as lvalues are referenced, temporaries & subexpressions are stored by value
+        template <typename E>
+        using Operand = std::conditional_t<std::is_lvalue_reference_v<E> && IsSimdArray_v<std::remove_cvref_t<E>>,
+            const std::remove_cvref_t<E>&, std::remove_cvref_t<E>>;
+
+        template <typename T, size_t N>
+        struct Scalar : ExpressionTag
+        {
+            using value_type = T;
+            static constexpr size_t size = N;
+
+            T value;
+
+            constexpr T operator[](size_t) const
+            {
+                return value;
+            }
+        };
+
+        template <typename Op, typename E>
+        struct UnaryExpr : ExpressionTag
+        {
+            using value_type = std::remove_cvref_t<decltype(Op{}(std::declval<E>()[0]))>;
+            static constexpr size_t size = std::remove_cvref_t<E>::size;
+
+            E expr;
+
+            constexpr value_type operator[](size_t i) const
+            {
+                return Op{}(expr[i]);
+            }
+        };
+
+        template <typename Op, typename L, typename R>
+        struct BinaryExpr : ExpressionTag
+        {
+            using value_type = std::remove_cvref_t<decltype(Op{}(std::declval<L>()[0], std::declval<R>()[0]))>;
+            static constexpr size_t size = std::remove_cvref_t<L>::size;
+
+            static_assert(size == std::remove_cvref_t<R>::size, "Sizes of operands must match");
+
+            L lhs;
+            R rhs;
+
+            constexpr value_type operator[](size_t i) const
+            {
+                return Op{}(lhs[i], rhs[i]);
+            }
+        };
+
+        template <typename Op, typename L, typename R>
+        constexpr auto make_binary(L&& lhs, R&& rhs)
+        {
+            return BinaryExpr<Op, Operand<L&&>, Operand<R&&>>{{}, std::forward<L>(lhs), std::forward<R>(rhs)};
+        }
+
+        template <typename E>
+        using ScalarFor = Scalar<typename std::remove_cvref_t<E>::value_type, std::remove_cvref_t<E>::size>;
+
+        // the scalar is converted to the element type explicitly - a braced init of e.g. double from int narrows
+        template <typename E, typename S>
+        constexpr ScalarFor<E> make_scalar(const S& value)
+        {
+            return ScalarFor<E>{{}, static_cast<typename ScalarFor<E>::value_type>(value)};
+        }
+    } // namespace SimdDetail
+
+    template <typename T, size_t N>
+    class SimdArray : public SimdDetail::ExpressionTag
+    {
+    public:
+        using value_type = T;
+        using iterator = T*;
+        using const_iterator = const T*;
+
+        static constexpr size_t size = N;
+        static constexpr size_t alignment = SimdDetail::alignment<T, N>();
+
+    private:
+        alignas(alignment) T items_[N]{};
+
+    public:
+        constexpr SimdArray() = default;
+
+        constexpr SimdArray(std::initializer_list<T> items)
+        {
+            std::copy_n(items.begin(), std::min(items.size(), N), items_);
+        }
+
+        template <ArrayExpression E>
+            requires(!std::same_as<std::remove_cvref_t<E>, SimdArray>)
+        constexpr SimdArray(const E& expr)
+        {
+            *this = expr;
+        }
+
+        template <ArrayExpression E>
+            requires(!std::same_as<std::remove_cvref_t<E>, SimdArray>)
+        constexpr SimdArray& operator=(const E& expr)
+        {
+            assign(expr, [](T& item, const auto& value) { item = value; });
+            return *this;
+        }
+
+        constexpr T& operator[](size_t index)
+        {
+            return items_[index];
+        }
+
+        constexpr const T& operator[](size_t index) const
+        {
+            return items_[index];
+        }
+
+        constexpr T* data()
+        {
+            return items_;
+        }
+
+        constexpr const T* data() const
+        {
+            return items_;
+        }
+
+        constexpr iterator begin()
+        {
+            return items_;
+        }
+
+        constexpr iterator end()
+        {
+            return items_ + N;
+        }
+
+        constexpr const_iterator begin() const
+        {
+            return items_;
+        }
+
+        constexpr const_iterator end() const
+        {
+            return items_ + N;
+        }
+
+        constexpr bool operator==(const SimdArray& other) const
+        {
+            return std::equal(items_, items_ + N, other.items_);
+        }
+
+        template <ArrayExpression E>
+        constexpr SimdArray& operator+=(const E& expr)
+        {
+            assign(expr, [](T& item, const auto& value) { item += value; });
+            return *this;
+        }
+
+        template <ArrayExpression E>
+        constexpr SimdArray& operator-=(const E& expr)
+        {
+            assign(expr, [](T& item, const auto& value) { item -= value; });
+            return *this;
+        }
+
+        template <ArrayExpression E>
+        constexpr SimdArray& operator*=(const E& expr)
+        {
+            assign(expr, [](T& item, const auto& value) { item *= value; });
+            return *this;
+        }
+
+        template <ArrayExpression E>
+        constexpr SimdArray& operator/=(const E& expr)
+        {
+            assign(expr, [](T& item, const auto& value) { item /= value; });
+            return *this;
+        }
+
+        constexpr SimdArray& operator+=(const T& value)
+        {
+            return *this += SimdDetail::Scalar<T, N>{{}, value};
+        }
+
+        constexpr SimdArray& operator-=(const T& value)
+        {
+            return *this -= SimdDetail::Scalar<T, N>{{}, value};
+        }
+
+        constexpr SimdArray& operator*=(const T& value)
+        {
+            return *this *= SimdDetail::Scalar<T, N>{{}, value};
+        }
+
+        constexpr SimdArray& operator/=(const T& value)
+        {
+            return *this /= SimdDetail::Scalar<T, N>{{}, value};
+        }
+
+    private:
+        // Element i of the result depends only on element i of operands, so operands may alias
+        // this array. For arithmetic types the expression is evaluated in blocks of one register:
+        // all loads of a block precede its stores, so the compiler vectorizes the loop without
+        // runtime overlap checks (it refuses to emit them at -O2) and no array-sized temporary is made.
+        template <typename E, typename Assign>
+        constexpr void assign(const E& expr, Assign assign_op)
+        {
+            static_assert(std::remove_cvref_t<E>::size == N, "Sizes of arrays must match");
+
+            using U = typename std::remove_cvref_t<E>::value_type;
+
+            if constexpr (std::is_arithmetic_v<T> && std::is_arithmetic_v<U>)
+            {
+                constexpr size_t block = SimdDetail::lanes<U, N>();
+
+                T* items = std::is_constant_evaluated() ? items_ : std::assume_aligned<alignment>(items_);
+
+                constexpr size_t blocked_size = N - N % block;
+
+                for (size_t i = 0; i < blocked_size; i += block)
+                {
+                    U values[block];
+                    for (size_t b = 0; b < block; ++b)
+                        values[b] = expr[i + b];
+                    for (size_t b = 0; b < block; ++b)
+                        assign_op(items[i + b], values[b]);
+                }
+                for (size_t i = blocked_size; i < N; ++i)
+                    assign_op(items[i], expr[i]);
+            }
+            else
+            {
+                // element i of the result depends only on element i of operands - aliasing is safe
+                for (size_t i = 0; i < N; ++i)
+                    assign_op(items_[i], expr[i]);
+            }
+        }
+    };
+
+    template <typename T, typename... Ts>
+    SimdArray(T, Ts...) -> SimdArray<T, 1 + sizeof...(Ts)>;
+
+    /////////////////////////////////////////////////////////////////
+    // element-wise operators
+
+#define SIMD_ARRAY_BINARY_OPERATOR(op, Op)                                                             \
+    template <ArrayExpression L, ArrayExpression R>                                                    \
+    constexpr auto operator op(L&& lhs, R&& rhs)                                                       \
+    {                                                                                                  \
+        return SimdDetail::make_binary<Op>(std::forward<L>(lhs), std::forward<R>(rhs));                \
+    }                                                                                                  \
+                                                                                                       \
+    template <ArrayExpression L, typename S>                                                           \
+        requires std::convertible_to<S, typename std::remove_cvref_t<L>::value_type>                   \
+    constexpr auto operator op(L&& lhs, const S& value)                                                \
+    {                                                                                                  \
+        return SimdDetail::make_binary<Op>(std::forward<L>(lhs), SimdDetail::make_scalar<L>(value));   \
+    }                                                                                                  \
+                                                                                                       \
+    template <typename S, ArrayExpression R>                                                           \
+        requires std::convertible_to<S, typename std::remove_cvref_t<R>::value_type>                   \
+    constexpr auto operator op(const S& value, R&& rhs)                                                \
+    {                                                                                                  \
+        return SimdDetail::make_binary<Op>(SimdDetail::make_scalar<R>(value), std::forward<R>(rhs));   \
+    }
+
+    SIMD_ARRAY_BINARY_OPERATOR(+, std::plus<>)
+    SIMD_ARRAY_BINARY_OPERATOR(-, std::minus<>)
+    SIMD_ARRAY_BINARY_OPERATOR(*, std::multiplies<>)
+    SIMD_ARRAY_BINARY_OPERATOR(/, std::divides<>)
+
+#undef SIMD_ARRAY_BINARY_OPERATOR
+
+    template <ArrayExpression E>
+    constexpr auto operator-(E&& expr)
+    {
+        return SimdDetail::UnaryExpr<std::negate<>, SimdDetail::Operand<E&&>>{{}, std::forward<E>(expr)};
+    }
+
+    /////////////////////////////////////////////////////////////////
+    // reductions
+
+    namespace SimdDetail
+    {
+        template <ArrayExpression E, typename Op>
+        constexpr auto reduce(const E& expr, Op op)
+        {
+            using T = typename std::remove_cvref_t<E>::value_type;
+            constexpr size_t size = std::remove_cvref_t<E>::size;
+            constexpr size_t lanes = SimdDetail::lanes<T, size>();
+
+            static_assert(size > 0, "Reduction of an empty array");
+
+            std::array<T, lanes> partial;
+            for (size_t l = 0; l < lanes; ++l)
+                partial[l] = expr[l];
+
+            size_t i = lanes;
+            for (; i + lanes <= size; i += lanes)
+                for (size_t l = 0; l < lanes; ++l)
+                    partial[l] = op(partial[l], expr[i + l]);
+
+            for (; i < size; ++i)
+                partial[0] = op(partial[0], expr[i]);
+
+            T result = partial[0];
+            for (size_t l = 1; l < lanes; ++l)
+                result = op(result, partial[l]);
+
+            return result;
+        }
+    } // namespace SimdDetail
+
+    template <ArrayExpression E>
+    constexpr auto sum(const E& expr)
+    {
+        return SimdDetail::reduce(expr, std::plus<>{});
+    }
+
+    template <ArrayExpression L, ArrayExpression R>
+    constexpr auto dot(const L& lhs, const R& rhs)
+    {
+        return sum(lhs * rhs);
+    }
+
+    template <ArrayExpression E>
+    constexpr auto min(const E& expr)
+    {
+        // the conditional form maps directly to min instructions
+        return SimdDetail::reduce(expr, [](const auto& a, const auto& b) { return b < a ? b : a; });
+    }
+
+    template <ArrayExpression E>
+    constexpr auto max(const E& expr)
+    {
+        return SimdDetail::reduce(expr, [](const auto& a, const auto& b) { return a < b ? b : a; });
+    }
+} // namespace ClassTemplates
+
+#endif // CLASS_TEMPLATES_SIMD_ARRAY_HPP
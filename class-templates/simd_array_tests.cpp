@@ -0,0 +1,223 @@
+#include "simd_array.hpp"
+
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+using namespace ClassTemplates;
+
+TEST_CASE("SimdArray - storage")
+{
+    SimdArray<float, 3> vec3 = {1.0f, 2.0f, 3.0f};
+
+    static_assert(alignof(SimdArray<float, 3>) == 16);
+    static_assert(alignof(SimdArray<double, 8>) == 64);
+    static_assert(sizeof(SimdArray<float, 16>) == 64);
+
+    CHECK(vec3[2] == 3.0f);
+    CHECK(std::accumulate(vec3.begin(), vec3.end(), 0.0f) == 6.0f);
+
+    SimdArray<int, 4> zeros;
+    CHECK(zeros == SimdArray<int, 4>{0, 0, 0, 0});
+
+    SimdArray deduced{1, 2, 3};
+    static_assert(std::is_same_v<decltype(deduced), SimdArray<int, 3>>);
+}
+
+TEST_CASE("SimdArray - element-wise operations")
+{
+    SimdArray<int, 4> a = {1, 2, 3, 4};
+    SimdArray<int, 4> b = {10, 20, 30, 40};
+
+    SECTION("expression is evaluated on assignment")
+    {
+        auto expr = a * 2 + b;
+        static_assert(!IsSimdArray_v<decltype(expr)>);
+
+        SimdArray<int, 4> result = expr;
+        CHECK(result == SimdArray<int, 4>{12, 24, 36, 48});
+    }
+
+    SECTION("all operators")
+    {
+        SimdArray<int, 4> result = (b - a) / 3 * (-a) + 1;
+        CHECK(result == SimdArray<int, 4>{-2, -11, -26, -47});
+
+        SimdArray<int, 4> scalar_first = 100 - a;
+        CHECK(scalar_first == SimdArray<int, 4>{99, 98, 97, 96});
+    }
+
+    SECTION("aliasing")
+    {
+        a = a + a * b;
+        CHECK(a == SimdArray<int, 4>{11, 42, 93, 164});
+    }
+
+    SECTION("aliasing - blocks & remainder")
+    {
+        SimdArray<int, 21> c; // 2 blocks of 8 + 5 items
+        for (size_t i = 0; i < c.size; ++i)
+            c[i] = static_cast<int>(i);
+
+        c = c * c + c;
+        for (size_t i = 0; i < c.size; ++i)
+            REQUIRE(c[i] == static_cast<int>(i * i + i));
+    }
+
+    SECTION("large arrays are assigned without a temporary copy")
+    {
+        constexpr size_t size = 4'000'000; // 16 MB - a temporary would overflow the stack
+        auto x = std::make_unique<SimdArray<float, size>>();
+        auto y = std::make_unique<SimdArray<float, size>>();
+        *x += 1.0f;
+        *y += 2.0f;
+
+        *x += *y * 3.0f;
+        CHECK((*x)[0] == 7.0f);
+        CHECK((*x)[size - 1] == 7.0f);
+    }
+
+    SECTION("compound assignment")
+    {
+        a += b;
+        a *= 2;
+        a -= b * 2;
+        CHECK(a == SimdArray<int, 4>{2, 4, 6, 8});
+    }
+
+    SECTION("temporary operands are stored by value")
+    {
+        auto expr = SimdArray<int, 4>{1, 1, 1, 1} + a;
+        SimdArray<int, 4> result = expr;
+        CHECK(result == SimdArray<int, 4>{2, 3, 4, 5});
+    }
+
+    SECTION("scalars of other arithmetic types")
+    {
+        SimdArray<double, 8> d;
+        d += 1.5;
+        SimdArray<double, 8> d_result = d * 2 + 1;
+        CHECK(d_result[7] == 4.0);
+
+        SimdArray<float, 8> f;
+        f += 1.5f;
+        SimdArray<float, 8> f_result = 2.0 * f - 0.5;
+        CHECK(f_result[0] == 2.5f);
+    }
+
+    SECTION("constexpr")
+    {
+        constexpr SimdArray<int, 3> c = SimdArray<int, 3>{1, 2, 3} * 3;
+        static_assert(c[2] == 9);
+        static_assert(sum(c) == 18);
+    }
+}
+
+TEST_CASE("SimdArray - reductions")
+{
+    SimdArray<float, 19> a;
+    SimdArray<float, 19> b;
+    for (size_t i = 0; i < a.size; ++i)
+    {
+        a[i] = static_cast<float>(i) - 9.0f;
+        b[i] = 2.0f;
+    }
+
+    CHECK(sum(a) == Catch::Approx(0.0));
+    CHECK(dot(a, b) == Catch::Approx(0.0));
+    CHECK(sum(a * a) == Catch::Approx(570.0));
+    CHECK(min(a) == -9.0f);
+    CHECK(max(a) == 9.0f);
+    CHECK(max(a * b - 1.0f) == 17.0f);
+
+    SimdArray<int64_t, 2> small = {3, -4};
+    CHECK(min(small) == -4);
+    CHECK(sum(small) == -1);
+}
+
+namespace
+{
+    // operators returning a new array - a temporary for every subexpression
+    template <typename T, size_t N>
+    std::array<T, N> operator+(const std::array<T, N>& a, const std::array<T, N>& b)
+    {
+        std::array<T, N> result;
+        for (size_t i = 0; i < N; ++i)
+            result[i] = a[i] + b[i];
+        return result;
+    }
+
+    template <typename T, size_t N>
+    std::array<T, N> operator*(const std::array<T, N>& a, T value)
+    {
+        std::array<T, N> result;
+        for (size_t i = 0; i < N; ++i)
+            result[i] = a[i] * value;
+        return result;
+    }
+
+    template <typename Vec>
+    struct Particle
+    {
+        Vec position{}, velocity{}, acceleration{};
+    };
+} // namespace
+
+TEST_CASE("SimdArray - physics kernel", "[.][benchmark]")
+{
+    constexpr size_t N = 16;
+    constexpr size_t count = 10'000;
+    constexpr float dt = 0.01f;
+
+    std::vector<Particle<std::array<float, N>>> naive(count);
+    std::vector<Particle<SimdArray<float, N>>> simd(count);
+
+    for (size_t p = 0; p < count; ++p)
+        for (size_t i = 0; i < N; ++i)
+        {
+            naive[p].velocity[i] = simd[p].velocity[i] = static_cast<float>(i);
+            naive[p].acceleration[i] = simd[p].acceleration[i] = static_cast<float>(p % 7);
+        }
+
+    BENCHMARK("std::array - naive operators")
+    {
+        for (auto& particle : naive)
+        {
+            particle.position = particle.position + particle.velocity * dt + particle.acceleration * (0.5f * dt * dt);
+            particle.velocity = particle.velocity + particle.acceleration * dt;
+        }
+        return naive.front().position[0];
+    };
+
+    BENCHMARK("SimdArray - expression templates")
+    {
+        for (auto& particle : simd)
+        {
+            particle.position += particle.velocity * dt + particle.acceleration * (0.5f * dt * dt);
+            particle.velocity += particle.acceleration * dt;
+        }
+        return simd.front().position[0];
+    };
+
+    BENCHMARK("std::array - dot products")
+    {
+        float result = 0.0f;
+        for (const auto& particle : naive)
+            for (size_t i = 0; i < N; ++i)
+                result += particle.velocity[i] * particle.acceleration[i];
+        return result;
+    };
+
+    BENCHMARK("SimdArray - dot products")
+    {
+        float result = 0.0f;
+        for (const auto& particle : simd)
+            result += dot(particle.velocity, particle.acceleration);
+        return result;
+    };
+}
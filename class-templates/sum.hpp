@@ -0,0 +1,187 @@
+#ifndef CLASS_TEMPLATES_SUM_HPP
+#define CLASS_TEMPLATES_SUM_HPP
+
+#include "execution_policy.hpp"
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////
+// SumAccumulator - type used to accumulate values of T
+//
+// Small integers are summed in 64 bits and float in double, so a sum of
+// many values does not overflow or lose precision. Specialize the trait
+// (or pass the accumulator explicitly) for other types.
+
+template <typename T>
+struct SumAccumulator
+{
+    using type = T;
+};
+
+template <std::signed_integral T>
+    requires(sizeof(T) < sizeof(int64_t))
+struct SumAccumulator<T>
+{
+    using type = int64_t;
+};
+
+template <std::unsigned_integral T>
+    requires(sizeof(T) < sizeof(uint64_t))
+struct SumAccumulator<T>
+{
+    using type = uint64_t;
+};
+
+template <>
+struct SumAccumulator<float>
+{
+    using type = double;
+};
+
+template <typename T>
+using SumAccumulator_t = typename SumAccumulator<T>::type;
+
+namespace SumDetail
+{
+    // smaller chunks cost more in scheduling than they gain
+    constexpr size_t min_chunk_size = 1 << 16;
+
+    template <typename Acc, typename It>
+    Acc sum_sequenced(It first, It last)
+    {
+        Acc result{};
+        for (; first != last; ++first)
+            result += static_cast<Acc>(*first);
+        return result;
+    }
+
+    // independent accumulators break the dependency chain, so the loop vectorizes
+    template <typename Acc, std::random_access_iterator It>
+    Acc sum_unsequenced(It first, It last)
+    {
+        constexpr size_t lanes = 8;
+
+        const size_t size = static_cast<size_t>(last - first);
+        Acc partial[lanes]{};
+
+        size_t i = 0;
+        for (; i + lanes <= size; i += lanes)
+            for (size_t l = 0; l < lanes; ++l)
+                partial[l] += static_cast<Acc>(first[i + l]);
+
+        Acc result{};
+        for (; i < size; ++i)
+            result += static_cast<Acc>(first[i]);
+        for (const auto& value : partial)
+            result += value;
+
+        return result;
+    }
+
+    template <typename Acc, typename Policy, typename It>
+    Acc sum_chunk(It first, It last)
+    {
+        if constexpr (Execution::IsUnsequenced_v<Policy> && std::random_access_iterator<It>)
+            return sum_unsequenced<Acc>(first, last);
+        else
+            return sum_sequenced<Acc>(first, last);
+    }
+
+    // chunks are summed by threads of the shared pool - the calling thread takes the first one
+    template <typename Acc, typename Policy, std::random_access_iterator It>
+    Acc sum_parallel(It first, It last)
+    {
+        ThreadPool& pool = default_thread_pool();
+
+        const size_t size = static_cast<size_t>(last - first);
+        const size_t chunk_count = std::clamp<size_t>(size / min_chunk_size, 1, pool.size() + 1);
+
+        if (chunk_count == 1)
+            return sum_chunk<Acc, Policy>(first, last);
+
+        const size_t chunk_size = size / chunk_count;
+        std::vector<Acc> partial_sums(chunk_count);
+        std::vector<std::exception_ptr> errors(chunk_count);
+
+        // the last chunk signals under the lock - the caller cannot return before it is released
+        size_t remaining = chunk_count - 1;
+        std::mutex done_mtx;
+        std::condition_variable done;
+
+        auto sum_nth_chunk = [&](size_t index) {
+            It chunk_first = first + index * chunk_size;
+            It chunk_last = index + 1 == chunk_count ? last : chunk_first + chunk_size;
+
+            try
+            {
+                partial_sums[index] = sum_chunk<Acc, Policy>(chunk_first, chunk_last);
+            }
+            catch (...)
+            {
+                errors[index] = std::current_exception();
+            }
+        };
+
+        for (size_t index = 1; index < chunk_count; ++index)
+            pool.submit([&, index] {
+                sum_nth_chunk(index);
+
+                std::lock_guard lk{done_mtx};
+                if (--remaining == 0)
+                    done.notify_all();
+            });
+
+        sum_nth_chunk(0);
+
+        // help until the queues are empty, then wait for chunks run by workers
+        while (pool.run_pending_task())
+        { }
+
+        {
+            std::unique_lock lk{done_mtx};
+            done.wait(lk, [&] { return remaining == 0; });
+        }
+
+        for (const auto& error : errors)
+            if (error)
+                std::rethrow_exception(error);
+
+        return sum_sequenced<Acc>(partial_sums.begin(), partial_sums.end());
+    }
+} // namespace SumDetail
+
+/////////////////////////////////////////////////////////////////
+// sum with an execution policy
+//
+// sum(Execution::par, values);           // SumAccumulator_t<value_type>
+// sum<int32_t>(Execution::seq, values);  // explicit accumulator
+//
+// Parallel policies split random-access containers into chunks;
+// other containers are summed on the calling thread.
+
+template <typename Acc = void, Execution::ExecutionPolicy Policy, typename Container>
+auto sum(Policy&&, const Container& container)
+{
+    using Result = std::conditional_t<std::is_void_v<Acc>, SumAccumulator_t<typename Container::value_type>, Acc>;
+    using ExecutionPolicy = std::remove_cvref_t<Policy>;
+
+    auto first = std::begin(container);
+    auto last = std::end(container);
+
+    if constexpr (Execution::IsParallel_v<ExecutionPolicy> && std::random_access_iterator<decltype(first)>)
+        return SumDetail::sum_parallel<Result, ExecutionPolicy>(first, last);
+    else
+        return SumDetail::sum_chunk<Result, ExecutionPolicy>(first, last);
+}
+
+#endif // CLASS_TEMPLATES_SUM_HPP
@@ -0,0 +1,95 @@
+#include "sum.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <list>
+#include <numeric>
+#include <vector>
+
+TEST_CASE("SumAccumulator")
+{
+    static_assert(std::is_same_v<SumAccumulator_t<int16_t>, int64_t>);
+    static_assert(std::is_same_v<SumAccumulator_t<uint8_t>, uint64_t>);
+    static_assert(std::is_same_v<SumAccumulator_t<int64_t>, int64_t>);
+    static_assert(std::is_same_v<SumAccumulator_t<float>, double>);
+    static_assert(std::is_same_v<SumAccumulator_t<double>, double>);
+}
+
+TEST_CASE("sum with execution policy")
+{
+    // 2^20 values - enough for a few parallel chunks
+    std::vector<int16_t> values(1 << 20, 30'000);
+    const int64_t expected = int64_t{30'000} << 20;
+
+    SECTION("no overflow for small integers")
+    {
+        CHECK(sum(Execution::seq, values) == expected);
+        CHECK(sum(Execution::unseq, values) == expected);
+        CHECK(sum(Execution::par, values) == expected);
+        CHECK(sum(Execution::par_unseq, values) == expected);
+    }
+
+    SECTION("explicit accumulator")
+    {
+        std::vector<int16_t> small(100, 1'000);
+        auto result = sum<int32_t>(Execution::par, small);
+
+        static_assert(std::is_same_v<decltype(result), int32_t>);
+        CHECK(result == 100'000);
+    }
+
+    SECTION("tail of values is summed")
+    {
+        std::vector<int> odd_size(1'000'003);
+        std::iota(odd_size.begin(), odd_size.end(), 0);
+
+        const int64_t expected_sum = int64_t{1'000'002} * 1'000'003 / 2;
+        CHECK(sum(Execution::par_unseq, odd_size) == expected_sum);
+        CHECK(sum(Execution::unseq, odd_size) == expected_sum);
+    }
+
+    SECTION("non random-access containers are summed sequentially")
+    {
+        std::list<float> lst = {0.5f, 1.5f, 2.0f};
+        CHECK(sum(Execution::par, lst) == Catch::Approx(4.0));
+    }
+
+    SECTION("empty container")
+    {
+        CHECK(sum(Execution::par_unseq, std::vector<int16_t>{}) == 0);
+    }
+}
+
+TEST_CASE("sum of 10^8 int16_t", "[.][benchmark]")
+{
+    std::vector<int16_t> values(100'000'000);
+    for (size_t i = 0; i < values.size(); ++i)
+        values[i] = static_cast<int16_t>(i % 1000);
+
+    BENCHMARK("std::accumulate - int64_t")
+    {
+        return std::accumulate(values.begin(), values.end(), int64_t{});
+    };
+
+    BENCHMARK("sum - seq")
+    {
+        return sum(Execution::seq, values);
+    };
+
+    BENCHMARK("sum - unseq")
+    {
+        return sum(Execution::unseq, values);
+    };
+
+    BENCHMARK("sum - par")
+    {
+        return sum(Execution::par, values);
+    };
+
+    BENCHMARK("sum - par_unseq")
+    {
+        return sum(Execution::par_unseq, values);
+    };
+}
@@ -1,3 +1,6 @@
+#include "data.hpp"
+#include "shapes.hpp"
+
 #include <catch2/catch_test_macros.hpp>
 #include <deque>
 #include <iostream>
@@ -120,41 +123,7 @@ TEST_CASE("requires expressions")
     static_assert(requires(X x, X y) { x == y; });
 }
 
-template <typename T>
-struct Data
-{
-    T value;
-
-    void print() const
-    {
-        std::cout << "value: " << value << "\n";
-    }
-
-    void print() const
-        requires std::ranges::range<T>
-    {
-        std::cout << "values: ";
-        for (const auto& item : value)
-        {
-            std::cout << item << " ";
-        }
-        std::cout << "\n";
-    }
-
-    void zero()
-    {
-        value = T{};
-    }
-
-    void zero()
-        requires std::ranges::range<T>
-    {
-        using TValue = std::ranges::range_value_t<T>;
-        for (auto&& item : value)
-            item = TValue{};
-    }
-};
-
+// Data<T> is defined in data.hpp
 TEST_CASE("requires clause for class method")
 {
     Data ds1{42};
@@ -182,72 +151,7 @@ concept SizedContainer = requires(T& container) {
 /////////////////////////////////////////////////////////
 // concept subsuming
 
-struct BoundingBox
-{
-    int w, h;
-};
-
-struct Color
-{
-    int r, g, b;
-};
-
-template <typename T>
-concept Shape = requires(T obj) {
-    {
-        obj.box()
-    } -> std::same_as<BoundingBox>;
-    obj.draw();
-};
-
-template <typename T>
-concept ShapeWithColor = Shape<T> && // ShapeWithColor subsumes Shape
-    requires(T obj, Color c) {
-        obj.set_color(c);
-        {
-            obj.get_color()
-        } -> std::convertible_to<Color>;
-    };
-
-template <Shape T>
-void render(T shp)
-{
-    shp.draw();
-}
-
-template <ShapeWithColor T>
-void render(T shp)
-{
-    std::cout << "Setting color & draw\n";
-    shp.set_color(Color{0, 255, 22});
-    shp.draw();
-}
-
-struct Rect
-{
-    int w, h;
-    Color color{};
-
-    BoundingBox box() const
-    {
-        return {w, h};
-    }
-
-    void draw() const
-    {
-        std::cout << "Drawing rect: " << w << ", " << h << "\n";
-    }
-
-    void set_color(Color c)
-    {
-        color = c;
-    }
-
-    Color get_color() const
-    {
-        return color;
-    }
-};
+// Shape, ShapeWithColor, render() & Rect are defined in shapes.hpp
 
 static_assert(Shape<Rect>);
 static_assert(ShapeWithColor<Rect>);
@@ -0,0 +1,91 @@
+#ifndef CONCEPTS_DATA_HPP
+#define CONCEPTS_DATA_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <ranges>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////
+// bulk operations on ranges
+
+// an object with all bits set to zero is equal to T{}
+template <typename T>
+concept TriviallyZeroable = std::is_arithmetic_v<T> || std::is_enum_v<T>;
+
+template <typename T>
+concept ContiguousZeroableRange = std::ranges::contiguous_range<T> && std::ranges::sized_range<T>
+    && TriviallyZeroable<std::ranges::range_value_t<T>>;
+
+template <typename T>
+constexpr bool IsBitVector_v = false;
+
+template <typename Allocator>
+constexpr bool IsBitVector_v<std::vector<bool, Allocator>> = true;
+
+// bits are packed into words - assigning items one by one masks a single bit at a time
+template <typename T>
+concept BitVector = std::ranges::random_access_range<T> && IsBitVector_v<T>;
+
+/////////////////////////////////////////////////////////////////
+// Data - zero() & print() are selected by requires clauses
+//
+// More constrained overloads win: ContiguousZeroableRange & BitVector
+// subsume std::ranges::range.
+
+template <typename T>
+struct Data
+{
+    T value;
+
+    void print(std::ostream& out = std::cout) const
+    {
+        out << "value: " << value << "\n";
+    }
+
+    // items are formatted into a buffer and written to the stream at once
+    void print(std::ostream& out = std::cout) const
+        requires std::ranges::range<T>
+    {
+        std::ostringstream buffer;
+        buffer << "values: ";
+        for (const auto& item : value)
+            buffer << item << " ";
+        buffer << "\n";
+
+        const auto text = std::move(buffer).str();
+        out.write(text.data(), static_cast<std::streamsize>(text.size()));
+    }
+
+    void zero()
+    {
+        value = T{};
+    }
+
+    void zero()
+        requires std::ranges::range<T>
+    {
+        using TValue = std::ranges::range_value_t<T>;
+        std::ranges::fill(value, TValue{});
+    }
+
+    void zero()
+        requires ContiguousZeroableRange<T>
+    {
+        if (const auto size = std::ranges::size(value); size > 0)
+            std::memset(std::ranges::data(value), 0, size * sizeof(std::ranges::range_value_t<T>));
+    }
+
+    // the standard library clears whole words
+    void zero()
+        requires BitVector<T>
+    {
+        value.assign(value.size(), false);
+    }
+};
+
+#endif // CONCEPTS_DATA_HPP
@@ -0,0 +1,169 @@
+#include "data.hpp"
+
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <fstream>
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std::literals;
+
+enum class Level : uint8_t
+{
+    low = 1,
+    high
+};
+
+static_assert(TriviallyZeroable<int>);
+static_assert(TriviallyZeroable<double>);
+static_assert(TriviallyZeroable<Level>);
+static_assert(!TriviallyZeroable<int*>);
+static_assert(!TriviallyZeroable<std::string>);
+
+static_assert(ContiguousZeroableRange<std::vector<int>>);
+static_assert(ContiguousZeroableRange<std::array<double, 4>>);
+static_assert(!ContiguousZeroableRange<std::vector<std::string>>);
+static_assert(!ContiguousZeroableRange<std::list<int>>);
+static_assert(!ContiguousZeroableRange<std::vector<bool>>);
+
+static_assert(BitVector<std::vector<bool>>);
+static_assert(!BitVector<std::vector<char>>);
+
+TEST_CASE("Data::zero")
+{
+    SECTION("single value")
+    {
+        Data ds{42};
+        ds.zero();
+        REQUIRE(ds.value == 0);
+    }
+
+    SECTION("contiguous range of arithmetic values")
+    {
+        Data ds{std::vector{1, 2, 3}};
+        ds.zero();
+        REQUIRE(ds.value == std::vector{0, 0, 0});
+
+        Data dbl{std::array{1.5, 2.5}};
+        dbl.zero();
+        REQUIRE(dbl.value == std::array{0.0, 0.0});
+
+        Data levels{std::vector{Level::low, Level::high}};
+        levels.zero();
+        REQUIRE(levels.value == std::vector{Level{}, Level{}});
+
+        Data<std::vector<int>> empty{};
+        empty.zero();
+        REQUIRE(empty.value.empty());
+    }
+
+    SECTION("vector<bool>")
+    {
+        // 130 bits - two full words & a partial one
+        std::vector<bool> bits(130, true);
+        Data ds{bits};
+        ds.zero();
+        REQUIRE(ds.value == std::vector<bool>(130, false));
+    }
+
+    SECTION("other ranges")
+    {
+        Data lst{std::list{1, 2, 3}};
+        lst.zero();
+        REQUIRE(lst.value == std::list{0, 0, 0});
+
+        Data words{std::vector{"one"s, "two"s}};
+        words.zero();
+        REQUIRE(words.value == std::vector{""s, ""s});
+    }
+}
+
+TEST_CASE("Data::print")
+{
+    std::ostringstream out;
+
+    SECTION("single value")
+    {
+        Data{42}.print(out);
+        REQUIRE(out.str() == "value: 42\n");
+    }
+
+    SECTION("range")
+    {
+        Data{std::vector{1, 2, 3}}.print(out);
+        REQUIRE(out.str() == "values: 1 2 3 \n");
+    }
+
+    SECTION("vector<bool>")
+    {
+        Data{std::vector<bool>{1, 0, 0, 1}}.print(out);
+        REQUIRE(out.str() == "values: 1 0 0 1 \n");
+    }
+}
+
+namespace
+{
+    // the former implementation of zero() for ranges
+    template <typename T>
+    void zero_item_by_item(T& range)
+    {
+        using TValue = std::ranges::range_value_t<T>;
+        for (auto&& item : range)
+            item = TValue{};
+    }
+} // namespace
+
+TEST_CASE("Data::zero - 10^8 items", "[.][benchmark]")
+{
+    const size_t size = 100'000'000;
+
+    Data ints{std::vector<int>(size, 1)};
+    Data bits{std::vector<bool>(size, true)};
+
+    BENCHMARK("vector<int> - item by item")
+    {
+        zero_item_by_item(ints.value);
+        return ints.value.back();
+    };
+
+    BENCHMARK("vector<int> - zero()")
+    {
+        ints.zero();
+        return ints.value.back();
+    };
+
+    BENCHMARK("vector<bool> - item by item")
+    {
+        zero_item_by_item(bits.value);
+        return bits.value.back();
+    };
+
+    BENCHMARK("vector<bool> - zero()")
+    {
+        bits.zero();
+        return bits.value.back();
+    };
+}
+
+TEST_CASE("Data::print - 10^6 items", "[.][benchmark]")
+{
+    Data ints{std::vector<int>(1'000'000, 42)};
+    std::ofstream out{"/dev/null"};
+
+    BENCHMARK("item by item")
+    {
+        out << "values: ";
+        for (const auto& item : ints.value)
+            out << item << " ";
+        out << "\n";
+    };
+
+    BENCHMARK("print()")
+    {
+        ints.print(out);
+    };
+}
@@ -0,0 +1,123 @@
+#ifndef CONCEPTS_RENDER_BATCH_HPP
+#define CONCEPTS_RENDER_BATCH_HPP
+
+#include "shapes.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////
+// render_all - renders collections of shapes without virtual calls
+//
+// The overload of render() is selected at compile time once per group of
+// shapes of the same type. Each group is rendered in a tight loop that the
+// compiler can inline & shapes are passed by reference.
+
+template <typename T>
+constexpr bool IsTuple_v = false;
+
+template <typename... Ts>
+constexpr bool IsTuple_v<std::tuple<Ts...>> = true;
+
+template <typename T>
+constexpr bool IsVariant_v = false;
+
+template <typename... Ts>
+constexpr bool IsVariant_v<std::variant<Ts...>> = true;
+
+template <typename R>
+concept ShapeVariantRange = std::ranges::input_range<R> && IsVariant_v<std::ranges::range_value_t<R>>;
+
+template <ShapeRange R>
+void render_all(R&& shapes)
+{
+    for (auto&& shp : shapes)
+        render(shp);
+}
+
+// items of a tuple are shapes or ranges of shapes
+template <typename Tuple>
+    requires IsTuple_v<std::remove_cvref_t<Tuple>>
+void render_all(Tuple&& groups)
+{
+    auto render_group = [](auto& group) {
+        if constexpr (Shape<std::remove_const_t<std::remove_reference_t<decltype(group)>>>)
+            render(group);
+        else
+            render_all(group);
+    };
+
+    std::apply([&](auto&&... group) { (render_group(group), ...); }, groups);
+}
+
+// shapes are drawn in their order - each item is dispatched with std::visit
+template <ShapeVariantRange R>
+void render_all(R&& shapes)
+{
+    for (auto&& item : shapes)
+        std::visit([](auto& shp) { render(shp); }, item);
+}
+
+/////////////////////////////////////////////////////////////////
+// ShapeBatch - shapes grouped by their type
+//
+// Shapes of the same type are drawn one after another - the order of drawing
+// is kept only within a group.
+
+template <typename T, typename... Ts>
+concept OneOf = (std::same_as<T, Ts> || ...);
+
+template <Shape... Ts>
+class ShapeBatch
+{
+public:
+    ShapeBatch() = default;
+
+    template <ShapeVariantRange R>
+        requires std::same_as<std::ranges::range_value_t<R>, std::variant<Ts...>>
+    explicit ShapeBatch(R&& shapes)
+    {
+        for (auto&& item : shapes)
+            std::visit([this](const auto& shp) { add(shp); }, item);
+    }
+
+    template <typename S>
+        requires OneOf<std::remove_cvref_t<S>, Ts...>
+    void add(S&& shp)
+    {
+        group<std::remove_cvref_t<S>>().push_back(std::forward<S>(shp));
+    }
+
+    template <OneOf<Ts...> S>
+    std::vector<S>& group()
+    {
+        return std::get<std::vector<S>>(groups_);
+    }
+
+    template <OneOf<Ts...> S>
+    const std::vector<S>& group() const
+    {
+        return std::get<std::vector<S>>(groups_);
+    }
+
+    size_t size() const
+    {
+        return std::apply([](const auto&... group) { return (group.size() + ... + 0); }, groups_);
+    }
+
+    void render()
+    {
+        render_all(groups_);
+    }
+
+private:
+    std::tuple<std::vector<Ts>...> groups_;
+};
+
+#endif // CONCEPTS_RENDER_BATCH_HPP
@@ -0,0 +1,275 @@
+#include "render_batch.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <tuple>
+#include <variant>
+#include <vector>
+
+namespace
+{
+    struct Canvas
+    {
+        long area = 0;
+        std::string log;
+    };
+
+    Canvas canvas;
+
+    struct Square
+    {
+        int a;
+
+        BoundingBox box() const
+        {
+            return {a, a};
+        }
+
+        void draw() const
+        {
+            canvas.area += a * a;
+        }
+    };
+
+    struct Frame
+    {
+        int w, h;
+
+        BoundingBox box() const
+        {
+            return {w, h};
+        }
+
+        void draw() const
+        {
+            canvas.area += 2 * (w + h);
+        }
+    };
+
+    struct Label
+    {
+        std::string text;
+        Color color{};
+
+        BoundingBox box() const
+        {
+            return {static_cast<int>(text.size()), 1};
+        }
+
+        void draw() const
+        {
+            canvas.log += text;
+        }
+
+        void set_color(Color c)
+        {
+            color = c;
+        }
+
+        Color get_color() const
+        {
+            return color;
+        }
+    };
+
+    // draw() is not const - still a Shape, rendered when not const
+    struct Sketch
+    {
+        int strokes = 0;
+
+        BoundingBox box() const
+        {
+            return {1, 1};
+        }
+
+        void draw()
+        {
+            ++strokes;
+            canvas.area += strokes;
+        }
+    };
+
+    static_assert(Shape<Sketch>);
+    static_assert(!Shape<const Sketch>);
+
+    static_assert(ShapeRange<std::vector<Square>>);
+    static_assert(ShapeRange<std::list<Frame>>);
+    static_assert(!ShapeRange<std::vector<int>>);
+    static_assert(ShapeVariantRange<std::vector<std::variant<Square, Frame>>>);
+} // namespace
+
+TEST_CASE("render")
+{
+    canvas = {};
+
+    SECTION("rvalue shape with color gets its color")
+    {
+        struct ColorProbe : Label
+        {
+            void draw() const
+            {
+                canvas.area += color.g;
+            }
+        };
+
+        render(ColorProbe{});
+        CHECK(canvas.area == 255);
+
+        const ColorProbe constant{};
+        render(constant);
+        CHECK(canvas.area == 255);
+    }
+
+    SECTION("shape with non-const draw")
+    {
+        Sketch sketch;
+        render(sketch);
+        render(sketch);
+        CHECK(sketch.strokes == 2);
+        CHECK(canvas.area == 3);
+    }
+}
+
+TEST_CASE("render_all")
+{
+    canvas = Canvas{};
+
+    SECTION("range of shapes")
+    {
+        std::vector squares{Square{1}, Square{2}, Square{3}};
+        render_all(squares);
+        REQUIRE(canvas.area == 14);
+    }
+
+    SECTION("tuple of shapes & ranges of shapes")
+    {
+        std::vector squares{Square{2}};
+        std::list frames{Frame{1, 2}, Frame{3, 4}};
+        Square square{1};
+        std::vector labels{Label{"a"}, Label{"b"}};
+
+        render_all(std::tie(squares, frames, square, labels));
+        render_all(std::tuple{Square{0}, std::vector<Frame>{}});
+
+        REQUIRE(canvas.area == 4 + 6 + 14 + 1);
+        REQUIRE(canvas.log == "ab");
+    }
+
+    SECTION("shapes with color are colored in place")
+    {
+        std::vector labels{Label{"a"}, Label{"b"}};
+        render_all(labels);
+
+        REQUIRE(std::ranges::all_of(labels, [](const Label& l) { return l.color.g == 255; }));
+    }
+
+    SECTION("range of variants keeps the order of drawing")
+    {
+        std::vector<std::variant<Square, Label>> shapes{Label{"a"}, Square{3}, Label{"b"}};
+        render_all(shapes);
+
+        REQUIRE(canvas.area == 9);
+        REQUIRE(canvas.log == "ab");
+        REQUIRE(std::get<Label>(shapes[2]).color.g == 255);
+    }
+}
+
+TEST_CASE("ShapeBatch")
+{
+    canvas = Canvas{};
+
+    std::vector<std::variant<Square, Frame, Label>> shapes{Label{"x"}, Square{3}, Frame{1, 1}, Label{"y"}, Square{1}};
+    ShapeBatch<Square, Frame, Label> batch{shapes};
+
+    REQUIRE(batch.size() == 5);
+    REQUIRE(batch.group<Square>().size() == 2);
+    REQUIRE(batch.group<Label>().size() == 2);
+
+    batch.add(Frame{2, 2});
+    REQUIRE(batch.group<Frame>().size() == 2);
+
+    batch.render();
+    REQUIRE(canvas.area == 9 + 4 + 1 + 8);
+    REQUIRE(canvas.log == "xy");
+    REQUIRE(batch.group<Label>().front().color.g == 255);
+}
+
+namespace
+{
+    struct Drawable
+    {
+        virtual ~Drawable() = default;
+        virtual void draw() const = 0;
+    };
+
+    template <typename S>
+    struct DrawableShape : Drawable
+    {
+        S shape;
+
+        explicit DrawableShape(S s)
+            : shape{s}
+        {
+        }
+
+        void draw() const override
+        {
+            shape.draw();
+        }
+    };
+} // namespace
+
+TEST_CASE("render 10^6 shapes", "[.][benchmark]")
+{
+    const size_t count = 1'000'000;
+
+    std::mt19937 rnd{42};
+    std::uniform_int_distribution<int> kind{0, 1}, size{1, 100};
+
+    std::vector<std::variant<Square, Frame>> shapes;
+    std::vector<std::unique_ptr<Drawable>> drawables;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (kind(rnd) == 0)
+        {
+            Square s{size(rnd)};
+            shapes.emplace_back(s);
+            drawables.push_back(std::make_unique<DrawableShape<Square>>(s));
+        }
+        else
+        {
+            Frame f{size(rnd), size(rnd)};
+            shapes.emplace_back(f);
+            drawables.push_back(std::make_unique<DrawableShape<Frame>>(f));
+        }
+    }
+
+    ShapeBatch<Square, Frame> batch{shapes};
+
+    BENCHMARK("virtual draw()")
+    {
+        canvas.area = 0;
+        for (const auto& d : drawables)
+            d->draw();
+        return canvas.area;
+    };
+
+    BENCHMARK("render_all - variants")
+    {
+        canvas.area = 0;
+        render_all(shapes);
+        return canvas.area;
+    };
+
+    BENCHMARK("ShapeBatch::render")
+    {
+        canvas.area = 0;
+        batch.render();
+        return canvas.area;
+    };
+}
@@ -0,0 +1,87 @@
+#ifndef CONCEPTS_SHAPES_HPP
+#define CONCEPTS_SHAPES_HPP
+
+#include <concepts>
+#include <iostream>
+#include <ranges>
+#include <type_traits>
+
+// boxes cover [x, x + w) x [y, y + h) - {w, h} boxes are placed at the origin
+struct BoundingBox
+{
+    int w, h;
+    int x = 0, y = 0;
+};
+
+struct Color
+{
+    int r, g, b;
+};
+
+template <typename T>
+concept Shape = requires(T obj) {
+    {
+        obj.box()
+    } -> std::same_as<BoundingBox>;
+    obj.draw();
+};
+
+template <typename T>
+concept ShapeWithColor = Shape<T> && // ShapeWithColor subsumes Shape
+    requires(T obj, Color c) {
+        obj.set_color(c);
+        {
+            obj.get_color()
+        } -> std::convertible_to<Color>;
+    };
+
+template <typename R>
+concept ShapeRange = std::ranges::input_range<R> && Shape<std::ranges::range_value_t<R>>;
+
+// shapes are forwarded - render() sets the color of the shape itself, not of a copy.
+// Constraints are checked for the argument as it is passed (const or not), so
+// a const shape is only drawn and an rvalue shape gets its color set too;
+// ShapeWithColor subsumes Shape for the same argument type.
+template <typename T>
+    requires Shape<std::remove_reference_t<T>>
+void render(T&& shp)
+{
+    shp.draw();
+}
+
+template <typename T>
+    requires ShapeWithColor<std::remove_reference_t<T>>
+void render(T&& shp)
+{
+    std::cout << "Setting color & draw\n";
+    shp.set_color(Color{0, 255, 22});
+    shp.draw();
+}
+
+struct Rect
+{
+    int w, h;
+    Color color{};
+
+    BoundingBox box() const
+    {
+        return {w, h};
+    }
+
+    void draw() const
+    {
+        std::cout << "Drawing rect: " << w << ", " << h << "\n";
+    }
+
+    void set_color(Color c)
+    {
+        color = c;
+    }
+
+    Color get_color() const
+    {
+        return color;
+    }
+};
+
+#endif // CONCEPTS_SHAPES_HPP
@@ -0,0 +1,195 @@
+#ifndef CONCEPTS_SPATIAL_INDEX_HPP
+#define CONCEPTS_SPATIAL_INDEX_HPP
+
+#include "shapes.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <ranges>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////
+// SpatialIndex - packed R-tree over bounding boxes of shapes
+//
+// The tree is bulk loaded once with Sort-Tile-Recursive packing: boxes are
+// sorted into vertical slices by x and each slice by y, consecutive runs of
+// node_size boxes form the leaves, consecutive runs of nodes form the next
+// level up to a single root. A query descends only into nodes whose box
+// overlaps the area, so it visits O(log n + k) nodes instead of all n shapes.
+//
+// Nodes of all levels are stored in one array per coordinate (SoA) - the
+// children of a node are adjacent, so the overlap test of a node is a loop
+// over a few contiguous ints. Shapes are identified by their position in the
+// range the index was built from.
+
+class SpatialIndex
+{
+public:
+    static constexpr size_t default_node_size = 16;
+
+    SpatialIndex() = default;
+
+    template <ShapeRange R>
+    explicit SpatialIndex(R&& shapes, size_t node_size = default_node_size)
+        : node_size_{std::max(node_size, size_t{2})}
+    {
+        std::vector<Item> items;
+        if constexpr (std::ranges::sized_range<R>)
+            items.reserve(std::ranges::size(shapes));
+
+        for (const auto& shp : shapes)
+            items.push_back(Item{to_box(shp.box()), items.size()});
+
+        build(items);
+    }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    // calls f(index) for every shape whose box overlaps the area
+    template <typename F>
+    void query(const BoundingBox& area, F&& f) const
+    {
+        if (empty())
+            return;
+
+        const Box box = to_box(area);
+        const size_t root = min_x_.size() - 1;
+        if (overlaps(root, box))
+            visit(root, level_bounds_.size() - 1, box, f);
+    }
+
+    std::vector<size_t> query(const BoundingBox& area) const
+    {
+        std::vector<size_t> result;
+        query(area, [&](size_t index) { result.push_back(index); });
+        return result;
+    }
+
+    // shapes whose box contains the point
+    std::vector<size_t> hit_test(int x, int y) const
+    {
+        return query(BoundingBox{.w = 1, .h = 1, .x = x, .y = y});
+    }
+
+private:
+    struct Box
+    {
+        int min_x, min_y, max_x, max_y;
+    };
+
+    struct Item
+    {
+        Box box;
+        size_t index;
+    };
+
+    size_t node_size_{default_node_size};
+    size_t size_{};
+
+    // nodes of level 0 are the boxes of shapes, the root is the last node
+    std::vector<int> min_x_, min_y_, max_x_, max_y_;
+    // index of a shape for level 0, position of the first child for other levels
+    std::vector<size_t> ids_;
+    // end of each level in the node arrays
+    std::vector<size_t> level_bounds_;
+
+    static Box to_box(const BoundingBox& bb)
+    {
+        return Box{bb.x, bb.y, bb.x + bb.w, bb.y + bb.h};
+    }
+
+    void add_node(const Box& box, size_t id)
+    {
+        min_x_.push_back(box.min_x);
+        min_y_.push_back(box.min_y);
+        max_x_.push_back(box.max_x);
+        max_y_.push_back(box.max_y);
+        ids_.push_back(id);
+    }
+
+    void build(std::vector<Item>& items)
+    {
+        size_ = items.size();
+        if (items.empty())
+            return;
+
+        // doubled centers - no rounding
+        auto center_x = [](const Item& item) { return static_cast<long long>(item.box.min_x) + item.box.max_x; };
+        auto center_y = [](const Item& item) { return static_cast<long long>(item.box.min_y) + item.box.max_y; };
+
+        const size_t leaf_count = (size_ + node_size_ - 1) / node_size_;
+        const auto slice_count = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(leaf_count))));
+        const size_t slice_size = slice_count * node_size_;
+
+        std::ranges::sort(items, {}, center_x);
+        for (size_t first = 0; first < size_; first += slice_size)
+        {
+            const auto slice = std::ranges::subrange(items.begin() + first, items.begin() + std::min(first + slice_size, size_));
+            std::ranges::sort(slice, {}, center_y);
+        }
+
+        const size_t node_count = size_ + size_ / (node_size_ - 1) + 1; // upper bound for all levels
+        for (auto* coords : {&min_x_, &min_y_, &max_x_, &max_y_})
+            coords->reserve(node_count);
+        ids_.reserve(node_count);
+
+        for (const auto& item : items)
+            add_node(item.box, item.index);
+        level_bounds_.push_back(size_);
+
+        // the root is a separate node even for a single shape
+        for (size_t first = 0, last = size_; first == 0 || last - first > 1; first = last, last = min_x_.size())
+        {
+            for (size_t child = first; child < last; child += node_size_)
+            {
+                const size_t end = std::min(child + node_size_, last);
+
+                Box box{min_x_[child], min_y_[child], max_x_[child], max_y_[child]};
+                for (size_t i = child + 1; i < end; ++i)
+                {
+                    box.min_x = std::min(box.min_x, min_x_[i]);
+                    box.min_y = std::min(box.min_y, min_y_[i]);
+                    box.max_x = std::max(box.max_x, max_x_[i]);
+                    box.max_y = std::max(box.max_y, max_y_[i]);
+                }
+
+                add_node(box, child);
+            }
+            level_bounds_.push_back(min_x_.size());
+        }
+    }
+
+    bool overlaps(size_t node, const Box& box) const
+    {
+        return (min_x_[node] < box.max_x) & (box.min_x < max_x_[node]) & (min_y_[node] < box.max_y) & (box.min_y < max_y_[node]);
+    }
+
+    template <typename F>
+    void visit(size_t node, size_t level, const Box& box, F& f) const
+    {
+        const size_t first = ids_[node];
+        const size_t last = std::min(first + node_size_, level_bounds_[level - 1]);
+
+        for (size_t child = first; child < last; ++child)
+        {
+            if (!overlaps(child, box))
+                continue;
+
+            if (level == 1)
+                f(ids_[child]);
+            else
+                visit(child, level - 1, box, f);
+        }
+    }
+};
+
+#endif // CONCEPTS_SPATIAL_INDEX_HPP
@@ -0,0 +1,157 @@
+#include "spatial_index.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <list>
+#include <random>
+#include <vector>
+
+namespace
+{
+    struct Tile
+    {
+        BoundingBox bounds;
+
+        BoundingBox box() const
+        {
+            return bounds;
+        }
+
+        void draw() const
+        {
+        }
+    };
+
+    bool overlap(const BoundingBox& a, const BoundingBox& b)
+    {
+        return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+    }
+
+    std::vector<size_t> full_scan(const std::vector<Tile>& tiles, const BoundingBox& area)
+    {
+        std::vector<size_t> result;
+        for (size_t i = 0; i < tiles.size(); ++i)
+            if (overlap(tiles[i].box(), area))
+                result.push_back(i);
+        return result;
+    }
+
+    std::vector<size_t> sorted(std::vector<size_t> indexes)
+    {
+        std::ranges::sort(indexes);
+        return indexes;
+    }
+
+    // boxes with sides of 1..max_size placed at random in [0, extent)^2
+    std::vector<Tile> random_tiles(size_t count, int extent, int max_size, unsigned seed = 665)
+    {
+        std::mt19937 rnd{seed};
+        std::uniform_int_distribution<int> position{0, extent - 1}, size{1, max_size};
+
+        std::vector<Tile> tiles;
+        tiles.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+            tiles.push_back(Tile{BoundingBox{.w = size(rnd), .h = size(rnd), .x = position(rnd), .y = position(rnd)}});
+        return tiles;
+    }
+} // namespace
+
+TEST_CASE("SpatialIndex - empty")
+{
+    SpatialIndex index{std::vector<Tile>{}};
+
+    REQUIRE(index.empty());
+    REQUIRE(index.query(BoundingBox{.w = 100, .h = 100}).empty());
+}
+
+TEST_CASE("SpatialIndex - query")
+{
+    std::vector tiles{
+        Tile{{.w = 10, .h = 10, .x = 0, .y = 0}},
+        Tile{{.w = 10, .h = 10, .x = 20, .y = 0}},
+        Tile{{.w = 5, .h = 5, .x = 8, .y = 8}},
+    };
+
+    SpatialIndex index{tiles, 2};
+    REQUIRE(index.size() == 3);
+
+    SECTION("overlapping boxes")
+    {
+        REQUIRE(sorted(index.query(BoundingBox{.w = 3, .h = 3, .x = 9, .y = 9})) == std::vector<size_t>{0, 2});
+        REQUIRE(index.query(BoundingBox{.w = 100, .h = 100, .x = -50, .y = -50}).size() == 3);
+    }
+
+    SECTION("boxes are half-open")
+    {
+        REQUIRE(index.query(BoundingBox{.w = 10, .h = 8, .x = 10, .y = 0}).empty());
+    }
+
+    SECTION("hit test")
+    {
+        REQUIRE(index.hit_test(25, 5) == std::vector<size_t>{1});
+        REQUIRE(sorted(index.hit_test(9, 9)) == std::vector<size_t>{0, 2});
+        REQUIRE(index.hit_test(15, 15).empty());
+    }
+
+    SECTION("any range of shapes")
+    {
+        std::list<Tile> tile_list(tiles.begin(), tiles.end());
+        SpatialIndex list_index{tile_list};
+        REQUIRE(list_index.hit_test(25, 5) == std::vector<size_t>{1});
+
+        SpatialIndex single{std::vector{Rect{10, 20}}};
+        REQUIRE(single.hit_test(5, 15) == std::vector<size_t>{0});
+    }
+}
+
+TEST_CASE("SpatialIndex - same result as a full scan")
+{
+    const auto tiles = random_tiles(10'000, 10'000, 200);
+    const auto areas = random_tiles(200, 10'000, 1'000, 42);
+
+    for (size_t node_size : {2, 4, 16, 64})
+    {
+        SpatialIndex index{tiles, node_size};
+
+        for (const auto& area : areas)
+            REQUIRE(sorted(index.query(area.box())) == full_scan(tiles, area.box()));
+    }
+}
+
+TEST_CASE("SpatialIndex - 10^6 shapes", "[.][benchmark]")
+{
+    const auto tiles = random_tiles(1'000'000, 100'000, 100);
+    const auto areas = random_tiles(100, 100'000, 500, 42);
+    const SpatialIndex index{tiles};
+
+    BENCHMARK("build")
+    {
+        return SpatialIndex{tiles}.size();
+    };
+
+    BENCHMARK("100 queries - full scan")
+    {
+        size_t count = 0;
+        for (const auto& area : areas)
+            for (const auto& tile : tiles)
+                count += overlap(tile.box(), area.box());
+        return count;
+    };
+
+    BENCHMARK("100 queries - SpatialIndex")
+    {
+        size_t count = 0;
+        for (const auto& area : areas)
+            index.query(area.box(), [&](size_t) { ++count; });
+        return count;
+    };
+
+    BENCHMARK("100 hit tests - SpatialIndex")
+    {
+        size_t count = 0;
+        for (const auto& area : areas)
+            count += index.hit_test(area.box().x, area.box().y).size();
+        return count;
+    };
+}
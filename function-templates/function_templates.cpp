@@ -1,3 +1,6 @@
+#include "call_traits.hpp"
+#include "string_compare.hpp"
+
 #include <catch2/catch_test_macros.hpp>
 #include <iostream>
 #include <string>
@@ -23,23 +26,30 @@ struct Id
     auto operator<=>(const Id& other) const = default;
 };
 
-template <typename T>
+// arguments are passed as CallTraits suggest (see type-traits/call_traits.hpp)
+template <PassedByValue T>
 T max_value(T a, T b)
 {
     return a < b ? b : a;
 }
 
+// no copies of large objects - like std::max the result refers to one of arguments
+template <typename T>
+    requires(!PassedByValue<T>)
+const T& max_value(const T& a, const T& b)
+{
+    return a < b ? b : a;
+}
+
 template <> // full specialization of template function
 const char* max_value(const char* a, const char* b)
 {
-    std::cout << __PRETTY_FUNCTION__ << " - template full specialization!\n";
-    return std::strcmp(a, b) < 0 ? b : a;
+    return StringCompare::less(a, b) ? b : a;
 }
 
 const char* max_value(const char* a, const char* b) // overloading
 {
-    std::cout << __PRETTY_FUNCTION__ << "\n";
-    return std::strcmp(a, b) < 0 ? b : a;
+    return StringCompare::less(a, b) ? b : a;
 }
 
 namespace Cpp20
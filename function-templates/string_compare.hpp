@@ -0,0 +1,101 @@
+#ifndef FUNCTION_TEMPLATES_STRING_COMPARE_HPP
+#define FUNCTION_TEMPLATES_STRING_COMPARE_HPP
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////
+// StringCompare - lexicographical comparison of byte strings
+//
+// - strings of known length are compared with memcmp of the common part
+//   (vectorized in the C library) & then by length - no search for '\0'
+// - PrefixKey packs the first 8 bytes of a string into an integer; equal
+//   prefixes are rare when many strings are compared, so most comparisons
+//   are a single integer comparison without touching the characters
+//
+// Bytes are compared as unsigned char - like strcmp & std::string_view.
+
+namespace StringCompare
+{
+    inline std::strong_ordering compare(std::string_view a, std::string_view b) noexcept
+    {
+        const size_t common = std::min(a.size(), b.size());
+        if (common > 0)
+        {
+            if (const int result = std::memcmp(a.data(), b.data(), common); result != 0)
+                return result <=> 0;
+        }
+        return a.size() <=> b.size();
+    }
+
+    inline bool less(std::string_view a, std::string_view b) noexcept
+    {
+        return compare(a, b) < 0;
+    }
+
+    inline bool less(const char* a, const char* b) noexcept
+    {
+        return std::strcmp(a, b) < 0;
+    }
+
+    // the first 8 bytes in big-endian order, padded with zeros
+    inline uint64_t prefix_key(std::string_view text) noexcept
+    {
+        uint64_t key = 0;
+        std::memcpy(&key, text.data(), std::min(text.size(), sizeof(key)));
+
+        if constexpr (std::endian::native == std::endian::little)
+            key = std::byteswap(key);
+
+        return key;
+    }
+
+    struct PrefixKey
+    {
+        uint64_t prefix;
+        std::string_view text;
+
+        explicit PrefixKey(std::string_view text) noexcept
+            : prefix{prefix_key(text)}
+            , text{text}
+        {
+        }
+
+        friend std::strong_ordering operator<=>(const PrefixKey& a, const PrefixKey& b) noexcept
+        {
+            if (a.prefix != b.prefix)
+                return a.prefix <=> b.prefix;
+
+            // equal keys - bytes up to the shorter string (at most 8) are equal
+            const size_t skip = std::min({a.text.size(), b.text.size(), sizeof(a.prefix)});
+            return compare(a.text.substr(skip), b.text.substr(skip));
+        }
+
+        friend bool operator==(const PrefixKey& a, const PrefixKey& b) noexcept
+        {
+            return a.prefix == b.prefix && a.text == b.text;
+        }
+    };
+
+    // sorts C strings - lengths & prefixes are computed once per string
+    inline void sort(std::span<const char*> strings)
+    {
+        std::vector<PrefixKey> keys;
+        keys.reserve(strings.size());
+        for (const char* text : strings)
+            keys.emplace_back(text);
+
+        std::ranges::sort(keys);
+
+        std::ranges::transform(keys, strings.begin(), [](const PrefixKey& key) { return key.text.data(); });
+    }
+} // namespace StringCompare
+
+#endif // FUNCTION_TEMPLATES_STRING_COMPARE_HPP
@@ -0,0 +1,122 @@
+#include "string_compare.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <compare>
+#include <cstring>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std::literals;
+
+TEST_CASE("StringCompare::compare")
+{
+    using StringCompare::compare;
+
+    CHECK(std::is_lt(compare("ala", "ola")));
+    CHECK(std::is_gt(compare("ola", "ala")));
+    CHECK(std::is_eq(compare("ala", "ala")));
+    CHECK(std::is_lt(compare("ala", "alan")));
+    CHECK(std::is_lt(compare("", "a")));
+    CHECK(std::is_eq(compare("", "")));
+
+    SECTION("bytes are unsigned")
+    {
+        CHECK(std::is_gt(compare("\xff", "a")));
+        CHECK(StringCompare::less("a", "\xff"));
+    }
+
+    SECTION("embedded zeros")
+    {
+        CHECK(std::is_lt(compare("ab\0c"sv, "ab\0d"sv)));
+        CHECK(std::is_lt(compare("ab"sv, "ab\0"sv)));
+    }
+}
+
+TEST_CASE("StringCompare::PrefixKey")
+{
+    using StringCompare::PrefixKey;
+
+    CHECK(StringCompare::prefix_key("ab") < StringCompare::prefix_key("b"));
+    CHECK(StringCompare::prefix_key("abcdefgh") == StringCompare::prefix_key("abcdefghijk"));
+
+    CHECK(PrefixKey{"ala"} < PrefixKey{"ola"});
+    CHECK(PrefixKey{"ala"} < PrefixKey{"alan"});
+    CHECK(PrefixKey{"abcdefgh-1"} < PrefixKey{"abcdefgh-2"});
+    CHECK(PrefixKey{"abcdefgh"} < PrefixKey{"abcdefgh-2"});
+    CHECK(PrefixKey{"abcdefgh-2"} == PrefixKey{"abcdefgh-2"});
+    CHECK(PrefixKey{"ab"sv} < PrefixKey{"ab\0"sv});
+    CHECK(PrefixKey{"\xff"} > PrefixKey{"a"});
+}
+
+namespace
+{
+    // words of 1..40 letters from 'a' to last_letter - a small alphabet gives many long common prefixes
+    std::vector<std::string> random_words(size_t count, char last_letter)
+    {
+        std::mt19937 rnd{665};
+        std::uniform_int_distribution<int> length{1, 40}, letter{'a', last_letter};
+
+        std::vector<std::string> words(count);
+        for (auto& word : words)
+        {
+            word.resize(length(rnd));
+            std::ranges::generate(word, [&] { return static_cast<char>(letter(rnd)); });
+        }
+        return words;
+    }
+
+    std::vector<const char*> c_strings(const std::vector<std::string>& words)
+    {
+        std::vector<const char*> result;
+        for (const auto& word : words)
+            result.push_back(word.c_str());
+        return result;
+    }
+} // namespace
+
+TEST_CASE("StringCompare::sort")
+{
+    const auto words = random_words(10'000, 'd');
+
+    auto expected = c_strings(words);
+    std::ranges::sort(expected, [](const char* a, const char* b) { return std::strcmp(a, b) < 0; });
+
+    auto strings = c_strings(words);
+    StringCompare::sort(strings);
+
+    REQUIRE(std::ranges::equal(strings, expected, [](const char* a, const char* b) { return std::strcmp(a, b) == 0; }));
+
+    std::vector<const char*> empty;
+    StringCompare::sort(empty);
+}
+
+TEST_CASE("sorting 10^6 C strings", "[.][benchmark]")
+{
+    const auto words = random_words(1'000'000, 'z');
+    const auto strings = c_strings(words);
+
+    BENCHMARK("std::sort - strcmp")
+    {
+        auto sorted = strings;
+        std::ranges::sort(sorted, [](const char* a, const char* b) { return std::strcmp(a, b) < 0; });
+        return sorted.front();
+    };
+
+    BENCHMARK("std::sort - string_view")
+    {
+        auto sorted = strings;
+        std::ranges::sort(sorted, [](std::string_view a, std::string_view b) { return a < b; });
+        return sorted.front();
+    };
+
+    BENCHMARK("StringCompare::sort - prefix keys")
+    {
+        auto sorted = strings;
+        StringCompare::sort(sorted);
+        return sorted.front();
+    };
+}
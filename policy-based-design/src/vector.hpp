@@ -1,11 +1,15 @@
 #ifndef CLASS_TEMPLATES_VECTOR_HPP
 #define CLASS_TEMPLATES_VECTOR_HPP
 
+#include "trivially_relocatable.hpp"
+
 #include <cstddef>
+#include <initializer_list>
 #include <iostream>
+#include <memory>
 #include <mutex>
 #include <stdexcept>
-#include <vector>
+#include <utility>
 
 
 /////////////////////////////////////////////////////////////////
@@ -83,13 +87,18 @@ using StdLock = std::mutex;
 
 ////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////
+// Vector - growing storage is relocated with a single memcpy for types
+// satisfying IsTriviallyRelocatable (see type-traits/trivially_relocatable.hpp)
+
 template <
     typename T,
     RangeChecker RangeCheckPolicy,
     Lockable LockingPolicy = NullMutex>
 class Vector : public RangeCheckPolicy
 {
-    std::vector<T> items_;
+    T* items_{};
+    size_t size_{};
+    size_t capacity_{};
     using mutex_type = LockingPolicy;
     mutable mutex_type mtx_;
 
@@ -98,36 +107,186 @@ public:
 
     template <typename U>
     Vector(std::initializer_list<U> il)
-        : items_{il}
     {
+        reserve_unlocked(il.size());
+
+        try
+        {
+            for (const auto& item : il)
+                emplace_back_unlocked(item);
+        }
+        catch (...)
+        {
+            release();
+            throw;
+        }
+    }
+
+    Vector(const Vector& other)
+        : RangeCheckPolicy(other)
+    {
+        std::lock_guard<mutex_type> lk{other.mtx_};
+
+        T* items = allocate(other.size_);
+        try
+        {
+            std::uninitialized_copy(other.items_, other.items_ + other.size_, items);
+        }
+        catch (...)
+        {
+            std::allocator<T>{}.deallocate(items, other.size_);
+            throw;
+        }
+
+        items_ = items;
+        size_ = capacity_ = other.size_;
+    }
+
+    Vector(Vector&& other) noexcept
+        : RangeCheckPolicy(std::move(other))
+    {
+        std::lock_guard<mutex_type> lk{other.mtx_};
+
+        items_ = std::exchange(other.items_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        capacity_ = std::exchange(other.capacity_, 0);
+    }
+
+    Vector& operator=(Vector other) noexcept
+    {
+        std::lock_guard<mutex_type> lk{mtx_};
+
+        static_cast<RangeCheckPolicy&>(*this) = std::move(static_cast<RangeCheckPolicy&>(other));
+        std::swap(items_, other.items_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+
+        return *this;
+    }
+
+    ~Vector()
+    {
+        release();
     }
 
     bool empty() const
     {
         std::lock_guard<mutex_type> lk{mtx_};
-        return items_.empty();
+        return size_ == 0;
     }
 
     size_t size() const
     {
         std::lock_guard<mutex_type> lk{mtx_};
-        return items_.size();
+        return size_;
+    }
+
+    size_t capacity() const
+    {
+        std::lock_guard<mutex_type> lk{mtx_};
+        return capacity_;
     }
 
     const T& at(size_t index) const
     {
         std::lock_guard<mutex_type> lk{mtx_};
 
-        RangeCheckPolicy::check_range(index, items_.size());
+        RangeCheckPolicy::check_range(index, size_);
 
-        return (index < items_.size()) ? items_[index] : items_.back();
+        return (index < size_) ? items_[index] : items_[size_ - 1];
+    }
+
+    void reserve(size_t new_capacity)
+    {
+        std::lock_guard<mutex_type> lk{mtx_};
+
+        reserve_unlocked(new_capacity);
     }
 
     void push_back(const T& item)
+    {
+        emplace_back(item);
+    }
+
+    void push_back(T&& item)
+    {
+        emplace_back(std::move(item));
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args)
     {
         std::lock_guard<mutex_type> lk{mtx_};
 
-        items_.push_back(item);
+        return emplace_back_unlocked(std::forward<Args>(args)...);
+    }
+
+private:
+    static T* allocate(size_t capacity)
+    {
+        return capacity > 0 ? std::allocator<T>{}.allocate(capacity) : nullptr;
+    }
+
+    void release() noexcept
+    {
+        std::destroy(items_, items_ + size_);
+        if (items_)
+            std::allocator<T>{}.deallocate(items_, capacity_);
+    }
+
+    void reserve_unlocked(size_t new_capacity)
+    {
+        if (new_capacity <= capacity_)
+            return;
+
+        T* new_items = allocate(new_capacity);
+        try
+        {
+            uninitialized_relocate(items_, items_ + size_, new_items);
+        }
+        catch (...)
+        {
+            std::allocator<T>{}.deallocate(new_items, new_capacity);
+            throw;
+        }
+
+        if (items_)
+            std::allocator<T>{}.deallocate(items_, capacity_);
+        items_ = new_items;
+        capacity_ = new_capacity;
+    }
+
+    template <typename... Args>
+    T& emplace_back_unlocked(Args&&... args)
+    {
+        if (size_ < capacity_)
+            return *std::construct_at(items_ + size_++, std::forward<Args>(args)...);
+
+        // the new item is constructed first - args may refer to an item being relocated
+        const size_t new_capacity = capacity_ == 0 ? 1 : 2 * capacity_;
+        T* new_items = allocate(new_capacity);
+        T* item = nullptr;
+
+        try
+        {
+            item = std::construct_at(new_items + size_, std::forward<Args>(args)...);
+            uninitialized_relocate(items_, items_ + size_, new_items);
+        }
+        catch (...)
+        {
+            if (item)
+                std::destroy_at(item);
+            std::allocator<T>{}.deallocate(new_items, new_capacity);
+            throw;
+        }
+
+        if (items_)
+            std::allocator<T>{}.deallocate(items_, capacity_);
+        items_ = new_items;
+        capacity_ = new_capacity;
+        ++size_;
+
+        return *item;
     }
 };
 
@@ -1,9 +1,14 @@
 #include "vector.hpp"
 
 #include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_all.hpp>
+#include <memory>
 #include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
 
 using namespace std;
 
@@ -44,3 +49,133 @@ SCENARIO("Policy based design for vector", "[Vector]")
         }
     }
 }
+
+SCENARIO("Vector growth", "[Vector]")
+{
+    GIVEN("Vector of trivially relocatable items")
+    {
+        Vector<std::unique_ptr<int>, ThrowingRangeChecker> vec;
+
+        WHEN("items are pushed beyond capacity")
+        {
+            for (int i = 0; i < 1000; ++i)
+                vec.push_back(std::make_unique<int>(i));
+
+            THEN("all items are kept")
+            {
+                REQUIRE(vec.size() == 1000);
+                REQUIRE(vec.capacity() >= 1000);
+                for (size_t i = 0; i < vec.size(); ++i)
+                    REQUIRE(*vec.at(i) == static_cast<int>(i));
+            }
+        }
+    }
+
+    GIVEN("Vector of strings - relocated with move & destroy")
+    {
+        Vector<std::string, ThrowingRangeChecker> vec = {"one", "two"};
+        vec.reserve(2);
+
+        WHEN("an item of the vector is pushed into full vector")
+        {
+            vec.push_back(vec.at(0));
+
+            THEN("a copy of the item is added")
+            {
+                REQUIRE(vec.size() == 3);
+                REQUIRE(vec.at(2) == "one");
+                REQUIRE(vec.at(0) == "one");
+            }
+        }
+
+        WHEN("vector is copied")
+        {
+            auto copy = vec;
+            copy.push_back("three");
+
+            THEN("copy is independent")
+            {
+                REQUIRE(vec.size() == 2);
+                REQUIRE(copy.size() == 3);
+            }
+        }
+    }
+}
+
+namespace
+{
+    // string without SSO - a pointer & a size, opted in as trivially relocatable
+    class HeapString
+    {
+        std::unique_ptr<char[]> text_;
+        size_t size_{};
+
+    public:
+        explicit HeapString(std::string_view text)
+            : text_{std::make_unique<char[]>(text.size())}
+            , size_{text.size()}
+        {
+            std::copy(text.begin(), text.end(), text_.get());
+        }
+
+        HeapString(HeapString&&) noexcept = default;
+        HeapString& operator=(HeapString&&) noexcept = default;
+    };
+} // namespace
+
+template <>
+struct IsTriviallyRelocatable<HeapString> : std::true_type
+{ };
+
+TEST_CASE("Vector - growth", "[.][benchmark]")
+{
+    constexpr int count = 100'000;
+
+    BENCHMARK("std::vector<std::unique_ptr<int>>")
+    {
+        std::vector<std::unique_ptr<int>> vec;
+        for (int i = 0; i < count; ++i)
+            vec.push_back(nullptr);
+        return vec.size();
+    };
+
+    BENCHMARK("Vector<std::unique_ptr<int>> - memcpy")
+    {
+        Vector<std::unique_ptr<int>, ThrowingRangeChecker> vec;
+        for (int i = 0; i < count; ++i)
+            vec.push_back(nullptr);
+        return vec.size();
+    };
+
+    BENCHMARK("std::vector<HeapString>")
+    {
+        std::vector<HeapString> vec;
+        for (int i = 0; i < count; ++i)
+            vec.push_back(HeapString{"text"});
+        return vec.size();
+    };
+
+    BENCHMARK("Vector<HeapString> - memcpy")
+    {
+        Vector<HeapString, ThrowingRangeChecker> vec;
+        for (int i = 0; i < count; ++i)
+            vec.push_back(HeapString{"text"});
+        return vec.size();
+    };
+
+    BENCHMARK("std::vector<std::string>")
+    {
+        std::vector<std::string> vec;
+        for (int i = 0; i < count; ++i)
+            vec.push_back("text");
+        return vec.size();
+    };
+
+    BENCHMARK("Vector<std::string> - move & destroy")
+    {
+        Vector<std::string, ThrowingRangeChecker> vec;
+        for (int i = 0; i < count; ++i)
+            vec.push_back("text");
+        return vec.size();
+    };
+}
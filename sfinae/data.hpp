@@ -0,0 +1,290 @@
+#ifndef SFINAE_DATA_HPP
+#define SFINAE_DATA_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////
+// Data - numeric buffer with reductions, transforms & multiply-add
+//
+// The implementation is selected by the type of items: the generic template
+// runs plain scalar loops, the specialization enabled for floating point types
+// keeps items in cache-line aligned storage and splits reductions into
+// independent lanes - a sequential floating point sum cannot be vectorized
+// without -ffast-math, a sum over lanes can. Results of reductions may differ
+// from a sequential sum in the last bits.
+
+namespace DataDetail
+{
+    template <typename T, size_t Alignment>
+    struct AlignedAllocator
+    {
+        using value_type = T;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = AlignedAllocator<U, Alignment>;
+        };
+
+        AlignedAllocator() = default;
+
+        template <typename U>
+        AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept
+        {
+        }
+
+        T* allocate(size_t n)
+        {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{Alignment}));
+        }
+
+        void deallocate(T* ptr, size_t n) noexcept
+        {
+            ::operator delete(ptr, n * sizeof(T), std::align_val_t{Alignment});
+        }
+
+        bool operator==(const AlignedAllocator&) const = default;
+    };
+
+    // container interface shared by all implementations
+    template <typename T, typename Storage>
+    class Buffer
+    {
+    public:
+        using value_type = T;
+        using iterator = typename Storage::iterator;
+        using const_iterator = typename Storage::const_iterator;
+
+        Buffer() = default;
+
+        explicit Buffer(size_t size, const T& value = T{})
+            : items_(size, value)
+        {
+        }
+
+        Buffer(std::initializer_list<T> items)
+            : items_(items)
+        {
+        }
+
+        size_t size() const
+        {
+            return items_.size();
+        }
+
+        bool empty() const
+        {
+            return items_.empty();
+        }
+
+        T* data()
+        {
+            return items_.data();
+        }
+
+        const T* data() const
+        {
+            return items_.data();
+        }
+
+        T& operator[](size_t index)
+        {
+            return items_[index];
+        }
+
+        const T& operator[](size_t index) const
+        {
+            return items_[index];
+        }
+
+        iterator begin()
+        {
+            return items_.begin();
+        }
+
+        iterator end()
+        {
+            return items_.end();
+        }
+
+        const_iterator begin() const
+        {
+            return items_.begin();
+        }
+
+        const_iterator end() const
+        {
+            return items_.end();
+        }
+
+        bool operator==(const Buffer& other) const
+        {
+            return std::equal(items_.begin(), items_.end(), other.items_.begin(), other.items_.end());
+        }
+
+    protected:
+        Storage items_;
+
+        void check_size(const Buffer& other) const
+        {
+            if (other.size() != size())
+                throw std::length_error("Data: sizes of operands do not match");
+        }
+    };
+} // namespace DataDetail
+
+template <typename T, typename Enabled = void>
+class Data : public DataDetail::Buffer<T, std::vector<T>>
+{
+    using Base = DataDetail::Buffer<T, std::vector<T>>;
+
+public:
+    static constexpr bool vectorized = false;
+
+    using Base::Base;
+
+    std::string info() const
+    {
+        return "Data(generic)";
+    }
+
+    T sum() const
+    {
+        return std::accumulate(this->items_.begin(), this->items_.end(), T{});
+    }
+
+    T dot(const Data& other) const
+    {
+        this->check_size(other);
+        return std::inner_product(this->items_.begin(), this->items_.end(), other.items_.begin(), T{});
+    }
+
+    template <typename F>
+    Data& transform(F f)
+    {
+        std::transform(this->items_.begin(), this->items_.end(), this->items_.begin(), f);
+        return *this;
+    }
+
+    // items[i] = a * x[i] + items[i]
+    Data& multiply_add(const T& a, const Data& x)
+    {
+        this->check_size(x);
+        for (size_t i = 0; i < this->items_.size(); ++i)
+            this->items_[i] += a * x.items_[i];
+        return *this;
+    }
+};
+
+template <typename T>
+using FloatingPoint = std::enable_if_t<std::is_floating_point_v<T>>;
+
+template <typename T>
+class Data<T, FloatingPoint<T>>
+    : public DataDetail::Buffer<T, std::vector<T, DataDetail::AlignedAllocator<T, 64>>>
+{
+    using Base = DataDetail::Buffer<T, std::vector<T, DataDetail::AlignedAllocator<T, 64>>>;
+
+public:
+    static constexpr bool vectorized = true;
+    static constexpr size_t alignment = 64;
+    // items processed per loop iteration & independent accumulators of reductions - one 256-bit register
+    static constexpr size_t lanes = 32 / sizeof(T);
+
+    using Base::Base;
+
+    std::string info() const
+    {
+        return "Data(floats)";
+    }
+
+    T sum() const
+    {
+        return reduce([](const T* items, size_t i) { return items[i]; });
+    }
+
+    T dot(const Data& other) const
+    {
+        this->check_size(other);
+
+        const T* y = std::assume_aligned<alignment>(other.data());
+        return reduce([y](const T* items, size_t i) { return items[i] * y[i]; });
+    }
+
+    template <typename F>
+    Data& transform(F f)
+    {
+        const T* items = std::assume_aligned<alignment>(this->data());
+        assign([&](size_t i) { return f(items[i]); });
+
+        return *this;
+    }
+
+    // items[i] = a * x[i] + items[i] - contracted to fma instructions
+    // when the target has them (-mfma, -march=native) & contraction is allowed (default for gnu++ dialects)
+    Data& multiply_add(T a, const Data& x)
+    {
+        this->check_size(x);
+
+        const T* items = std::assume_aligned<alignment>(this->data());
+        const T* xs = std::assume_aligned<alignment>(x.data());
+        assign([&](size_t i) { return a * xs[i] + items[i]; });
+
+        return *this;
+    }
+
+private:
+    // items[i] = value(i) - evaluated in blocks of lanes, which are vectorized at -O2
+    // (its cheap cost model gives up on loops that need a scalar remainder);
+    // a block is evaluated before it is stored, so operands may overlap the items
+    template <typename Value>
+    void assign(Value value)
+    {
+        T* items = std::assume_aligned<alignment>(this->data());
+        const size_t size = this->size();
+        const size_t vectorized_size = size - size % lanes;
+
+        for (size_t i = 0; i < vectorized_size; i += lanes)
+        {
+            std::array<T, lanes> block;
+            for (size_t lane = 0; lane < lanes; ++lane)
+                block[lane] = value(i + lane);
+            std::copy(block.begin(), block.end(), items + i);
+        }
+
+        for (size_t i = vectorized_size; i < size; ++i)
+            items[i] = value(i);
+    }
+
+    template <typename Term>
+    T reduce(Term term) const
+    {
+        const T* items = std::assume_aligned<alignment>(this->data());
+        const size_t size = this->size();
+        const size_t vectorized_size = size - size % lanes;
+
+        std::array<T, lanes> partial{};
+        for (size_t i = 0; i < vectorized_size; i += lanes)
+            for (size_t lane = 0; lane < lanes; ++lane)
+                partial[lane] += term(items, i + lane);
+
+        T result = std::accumulate(partial.begin(), partial.end(), T{});
+        for (size_t i = vectorized_size; i < size; ++i)
+            result += term(items, i);
+
+        return result;
+    }
+};
+
+#endif // SFINAE_DATA_HPP
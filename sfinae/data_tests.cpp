@@ -0,0 +1,157 @@
+#include "data.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+
+// an explicit second argument disables the specialization for floating point types
+struct Scalar
+{ };
+
+template <typename T>
+using ScalarData = Data<T, Scalar>;
+
+TEST_CASE("Data - implementation is selected by type of items")
+{
+    static_assert(!Data<int>::vectorized);
+    static_assert(!Data<int64_t>::vectorized);
+    static_assert(Data<float>::vectorized);
+    static_assert(Data<double>::vectorized);
+    static_assert(!ScalarData<double>::vectorized);
+
+    static_assert(Data<float>::lanes == 8);
+    static_assert(Data<double>::lanes == 4);
+
+    Data<double> floats(1001);
+    REQUIRE(reinterpret_cast<uintptr_t>(floats.data()) % Data<double>::alignment == 0);
+}
+
+TEST_CASE("Data - container")
+{
+    Data<int> ints{1, 2, 3};
+    REQUIRE(ints.size() == 3);
+    REQUIRE(ints[1] == 2);
+    REQUIRE(ints == Data<int>{1, 2, 3});
+
+    Data<double> doubles(3, 0.5);
+    REQUIRE(doubles == Data<double>{0.5, 0.5, 0.5});
+    REQUIRE(Data<float>{}.empty());
+}
+
+TEMPLATE_TEST_CASE("Data - kernels", "", Data<int64_t>, Data<float>, Data<double>, ScalarData<double>)
+{
+    // 1001 items - the loops over lanes are followed by a remainder
+    TestType data(1001);
+    std::iota(data.begin(), data.end(), 0);
+
+    SECTION("sum")
+    {
+        REQUIRE(data.sum() == 500'500);
+    }
+
+    SECTION("dot")
+    {
+        TestType ones(1001, 1);
+        REQUIRE(data.dot(ones) == 500'500);
+        REQUIRE(ones.dot(ones) == 1001);
+    }
+
+    SECTION("transform")
+    {
+        data.transform([](auto x) { return x * 2; });
+        REQUIRE(data[1000] == 2000);
+        REQUIRE(data.sum() == 1'001'000);
+    }
+
+    SECTION("multiply_add")
+    {
+        TestType ones(1001, 1);
+        ones.multiply_add(3, data);
+        REQUIRE(ones[0] == 1);
+        REQUIRE(ones[1000] == 3001);
+    }
+
+    SECTION("sizes of operands must match")
+    {
+        TestType other(10);
+        REQUIRE_THROWS_AS(data.dot(other), std::length_error);
+        REQUIRE_THROWS_AS(data.multiply_add(1, other), std::length_error);
+    }
+
+    SECTION("empty buffer")
+    {
+        TestType empty;
+        REQUIRE(empty.sum() == 0);
+        REQUIRE(empty.dot(empty) == 0);
+    }
+}
+
+TEST_CASE("Data - floating point reductions")
+{
+    Data<double> data(10'000);
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = 1.0 / static_cast<double>(i + 1);
+
+    const double expected = std::accumulate(data.begin(), data.end(), 0.0);
+    REQUIRE(data.sum() == Catch::Approx(expected));
+    REQUIRE(data.dot(data) == Catch::Approx(std::inner_product(data.begin(), data.end(), data.begin(), 0.0)));
+}
+
+TEST_CASE("Data - scalar vs vectorized kernels", "[.][benchmark]")
+{
+    // 2^16 doubles - 512 kB, kept in L2 cache
+    const size_t size = 1 << 16;
+
+    ScalarData<double> scalar_x(size), scalar_y(size);
+    Data<double> x(size), y(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        scalar_x[i] = x[i] = std::sin(static_cast<double>(i));
+        scalar_y[i] = y[i] = std::cos(static_cast<double>(i));
+    }
+
+    BENCHMARK("sum - generic")
+    {
+        return scalar_x.sum();
+    };
+
+    BENCHMARK("sum - floating point")
+    {
+        return x.sum();
+    };
+
+    BENCHMARK("dot - generic")
+    {
+        return scalar_x.dot(scalar_y);
+    };
+
+    BENCHMARK("dot - floating point")
+    {
+        return x.dot(y);
+    };
+
+    BENCHMARK("multiply_add - generic")
+    {
+        return scalar_y.multiply_add(1e-9, scalar_x).size();
+    };
+
+    BENCHMARK("multiply_add - floating point")
+    {
+        return y.multiply_add(1e-9, x).size();
+    };
+
+    BENCHMARK("transform - generic")
+    {
+        return scalar_x.transform([](double v) { return v * 0.5 + 0.25; }).size();
+    };
+
+    BENCHMARK("transform - floating point")
+    {
+        return x.transform([](double v) { return v * 0.5 + 0.25; }).size();
+    };
+}
@@ -1,3 +1,6 @@
+#include "call_traits.hpp"
+#include "data.hpp"
+
 #include <catch2/catch_test_macros.hpp>
 #include <iostream>
 #include <string>
@@ -87,6 +90,23 @@ namespace Cpp20
     }
 }
 
+// the convention is chosen by CallTraits - size, trivial copy & destruction (see type-traits/call_traits.hpp)
+namespace WithCallTraits
+{
+    template <PassedByValue T>
+    void do_stuff(T)
+    {
+        std::cout << "do_stuff(obj passed by value)\n";
+    }
+
+    template <typename T>
+        requires(!PassedByValue<T>)
+    void do_stuff(const T&)
+    {
+        std::cout << "do_stuff(obj passed by ref)\n";
+    }
+} // namespace WithCallTraits
+
 ///////////////////////////////////////////
 
 TEST_CASE("SFINAE")
@@ -94,55 +114,27 @@ TEST_CASE("SFINAE")
     int x = 10;
     do_stuff(x);
     Cpp20::do_stuff(x);
+    WithCallTraits::do_stuff(x);
 
     std::vector vec = {1, 2, 3};
     ver_3::do_stuff(vec);
     Cpp20::do_stuff(vec);
+    WithCallTraits::do_stuff(vec);
+
+    std::string_view text = "text"; // 16 bytes - still passed in registers
+    WithCallTraits::do_stuff(text);
 }
 
 ////////////////////////////////////////////
 
 ///////////////////////////////////////////////////////////////////////////////
-/// enable_if & sfinae in class templates
-template <typename T, typename Enabled = void>
-struct Data
-{
-public:
-    Data()
-    {
-        std::cout << "Data(generic)" << std::endl;
-    }
-
-    std::string info() const
-    {
-        return "Data(generic)";
-    }
-};
-
-template <typename T>
-using FloatingPoint = std::enable_if_t<std::is_floating_point_v<T>>;
-
-template <typename T>
-struct Data<T, FloatingPoint<T>>
-{
-public:
-    Data()
-    {
-        std::cout << "Data(floats)" << std::endl;
-    }
-
-    std::string info() const
-    {
-        return "Data(floats)";
-    }
-};
+/// enable_if & sfinae in class templates - Data<T> is defined in data.hpp
 
 TEST_CASE("enable_if + class templates")
 {
     Data<int> ds1;
-    ds1.info();
+    CHECK(ds1.info() == "Data(generic)");
 
     Data<double> ds2;
-    ds2.info();
+    CHECK(ds2.info() == "Data(floats)");
 }
-
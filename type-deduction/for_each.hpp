@@ -0,0 +1,116 @@
+#ifndef TYPE_DEDUCTION_FOR_EACH_HPP
+#define TYPE_DEDUCTION_FOR_EACH_HPP
+
+#include "execution_policy.hpp"
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <type_traits>
+
+template <typename InputIter, typename Function>
+void my_for_each(InputIter first, InputIter last, Function f)
+{
+    for(InputIter it = first; it != last; ++it)
+    {
+        f(*it);
+    }
+}
+
+/////////////////////////////////////////////////////////////////
+// my_for_each with an execution policy
+//
+// Parallel policies split a random access range into chunks of about
+// chunk_bytes of items - big enough to amortize scheduling, small enough to
+// balance the load when some items take longer. The chunks run on a
+// ThreadPool; the calling thread works on them too. f is shared by all
+// threads - it must be safe to call concurrently. The first exception thrown
+// by f is rethrown after all started chunks have finished.
+//
+// Sequenced policies and iterators without random access run serially.
+
+namespace ForEachDetail
+{
+    constexpr size_t chunk_bytes = 64 * 1024;
+
+    template <typename It>
+    constexpr size_t chunk_size()
+    {
+        return std::max(chunk_bytes / sizeof(std::iter_value_t<It>), size_t{1});
+    }
+
+    template <std::random_access_iterator It, typename Function>
+    void parallel_for_each(ThreadPool& pool, It first, It last, Function& f, size_t chunk_size)
+    {
+        const size_t size = static_cast<size_t>(last - first);
+        const size_t chunk_count = (size + chunk_size - 1) / chunk_size;
+
+        if (chunk_count <= 1 || pool.size() == 0)
+        {
+            my_for_each(first, last, std::ref(f));
+            return;
+        }
+
+        // the last chunk signals under the lock - the caller cannot return before it is released
+        size_t remaining = chunk_count;
+        std::mutex done_mtx;
+        std::condition_variable done;
+        std::exception_ptr error;
+
+        auto run_chunk = [&](size_t chunk) {
+            const auto chunk_first = first + static_cast<std::iter_difference_t<It>>(chunk * chunk_size);
+            const auto chunk_last = first + static_cast<std::iter_difference_t<It>>(std::min(size, (chunk + 1) * chunk_size));
+
+            try
+            {
+                my_for_each(chunk_first, chunk_last, std::ref(f));
+            }
+            catch (...)
+            {
+                std::lock_guard lk{done_mtx};
+                if (!error)
+                    error = std::current_exception();
+            }
+
+            std::lock_guard lk{done_mtx};
+            if (--remaining == 0)
+                done.notify_all();
+        };
+
+        for (size_t chunk = 0; chunk < chunk_count; ++chunk)
+            pool.submit([&run_chunk, chunk] { run_chunk(chunk); });
+
+        // help until the queues are empty, then wait for chunks run by workers
+        while (pool.run_pending_task())
+        { }
+
+        std::unique_lock lk{done_mtx};
+        done.wait(lk, [&] { return remaining == 0; });
+
+        if (error)
+            std::rethrow_exception(error);
+    }
+} // namespace ForEachDetail
+
+template <Execution::ExecutionPolicy Policy, typename InputIter, typename Function>
+void my_for_each(Policy&&, InputIter first, InputIter last, Function f)
+{
+    if constexpr (Execution::IsParallel_v<std::remove_cvref_t<Policy>> && std::random_access_iterator<InputIter>)
+        ForEachDetail::parallel_for_each(default_thread_pool(), first, last, f, ForEachDetail::chunk_size<InputIter>());
+    else
+        my_for_each(first, last, f);
+}
+
+// runs on the given pool - e.g. with a chosen number of threads
+template <std::random_access_iterator Iter, typename Function>
+void my_for_each(ThreadPool& pool, Iter first, Iter last, Function f)
+{
+    ForEachDetail::parallel_for_each(pool, first, last, f, ForEachDetail::chunk_size<Iter>());
+}
+
+#endif // TYPE_DEDUCTION_FOR_EACH_HPP
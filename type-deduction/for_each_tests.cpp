@@ -0,0 +1,159 @@
+#include "for_each.hpp"
+
+#include <atomic>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cmath>
+#include <list>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::literals;
+
+TEST_CASE("ThreadPool")
+{
+    ThreadPool pool{3};
+    REQUIRE(pool.size() == 3);
+
+    SECTION("runs all tasks")
+    {
+        std::atomic<int> counter{0};
+        for (int i = 0; i < 1000; ++i)
+            pool.submit([&] { ++counter; });
+
+        while (counter < 1000)
+            if (!pool.run_pending_task())
+                std::this_thread::yield();
+
+        REQUIRE(counter == 1000);
+    }
+
+    SECTION("tasks may submit tasks")
+    {
+        std::atomic<int> counter{0};
+        for (int i = 0; i < 10; ++i)
+            pool.submit([&] {
+                for (int j = 0; j < 10; ++j)
+                    pool.submit([&] { ++counter; });
+            });
+
+        while (counter < 100)
+            if (!pool.run_pending_task())
+                std::this_thread::yield();
+
+        REQUIRE(counter == 100);
+    }
+}
+
+TEST_CASE("my_for_each with execution policy")
+{
+    std::vector<int> values(1'000'000);
+    std::iota(values.begin(), values.end(), 0);
+
+    SECTION("par - all items are visited once")
+    {
+        my_for_each(Execution::par, values.begin(), values.end(), [](int& x) { x *= 2; });
+
+        for (size_t i = 0; i < values.size(); ++i)
+            REQUIRE(values[i] == 2 * static_cast<int>(i));
+    }
+
+    SECTION("chunks run on many threads")
+    {
+        ThreadPool pool{3};
+        REQUIRE(pool.size() > 0);
+
+        constexpr size_t chunk_size = ForEachDetail::chunk_size<std::vector<int>::iterator>();
+        const size_t chunk_count = (values.size() + chunk_size - 1) / chunk_size;
+
+        std::mutex mtx;
+        size_t chunk_starts = 0;
+        std::set<std::thread::id> threads;
+
+        my_for_each(pool, values.begin(), values.end(), [&](int& x) {
+            if (static_cast<size_t>(x) % chunk_size == 0)
+            {
+                {
+                    std::lock_guard lk{mtx};
+                    ++chunk_starts;
+                    threads.insert(std::this_thread::get_id());
+                }
+                std::this_thread::sleep_for(1ms); // other threads take chunks meanwhile
+            }
+            x += 1;
+        });
+
+        REQUIRE(values.back() == 1'000'000);
+        CHECK(chunk_starts == chunk_count);
+        CHECK(threads.size() > 1);
+        CHECK(threads.size() <= pool.size() + 1);
+    }
+
+    SECTION("nested parallel loops")
+    {
+        std::vector<std::vector<int>> rows(16, values);
+        my_for_each(Execution::par, rows.begin(), rows.end(), [](std::vector<int>& row) {
+            my_for_each(Execution::par, row.begin(), row.end(), [](int& x) { x = -x; });
+        });
+
+        REQUIRE(rows[15][999'999] == -999'999);
+    }
+
+    SECTION("seq & input iterators run serially")
+    {
+        const auto caller = std::this_thread::get_id();
+
+        std::list<int> lst(1000, 1);
+        my_for_each(Execution::par, lst.begin(), lst.end(), [&](int& x) {
+            REQUIRE(std::this_thread::get_id() == caller);
+            x = 2;
+        });
+        REQUIRE(std::accumulate(lst.begin(), lst.end(), 0) == 2000);
+
+        my_for_each(Execution::seq, values.begin(), values.begin() + 10, [&](int& x) {
+            REQUIRE(std::this_thread::get_id() == caller);
+            x = 0;
+        });
+        REQUIRE(values[9] == 0);
+    }
+
+    SECTION("exceptions are propagated")
+    {
+        REQUIRE_THROWS_AS(my_for_each(Execution::par, values.begin(), values.end(), [](int x) {
+            if (x == 500'000)
+                throw std::runtime_error("error");
+        }),
+            std::runtime_error);
+    }
+}
+
+TEST_CASE("my_for_each - transform of 10^7 items", "[.][benchmark]")
+{
+    std::vector<double> values(10'000'000, 2.0);
+    auto transform = [](double& x) { x = std::sqrt(x * x + 1.0); };
+
+    BENCHMARK("serial")
+    {
+        my_for_each(values.begin(), values.end(), transform);
+        return values.back();
+    };
+
+    // speedup curve - the calling thread works too, so the pool has threads - 1 workers
+    const unsigned max_threads = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned threads = 1; threads <= max_threads; threads *= 2)
+    {
+        ThreadPool pool{threads - 1};
+
+        BENCHMARK("par - " + std::to_string(threads) + " thread(s)")
+        {
+            my_for_each(pool, values.begin(), values.end(), transform);
+            return values.back();
+        };
+    }
+}
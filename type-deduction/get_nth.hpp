@@ -0,0 +1,74 @@
+#ifndef TYPE_DEDUCTION_GET_NTH_HPP
+#define TYPE_DEDUCTION_GET_NTH_HPP
+
+#include <bitset>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+
+/////////////////////////////////////////////////////////////////
+// get_nth - access to the nth item of any range
+//
+// decltype(auto) returns exactly what the access expression yields:
+// a reference for ordinary containers, a proxy object for bit containers
+// (std::vector<bool>, std::bitset) - assigning through the result modifies
+// the container in every case. Nothing is copied or allocated.
+//
+// The cost follows the iterator category: O(1) for random access ranges,
+// O(n) with std::ranges::next for the others. The index is not checked.
+
+namespace TraitsDriven
+{
+    template <typename T>
+    struct IsBitset : std::false_type
+    { };
+
+    template <size_t N>
+    struct IsBitset<std::bitset<N>> : std::true_type
+    { };
+
+    template <typename T>
+    constexpr bool IsBitset_v = IsBitset<std::remove_cv_t<T>>::value;
+
+    enum class Access
+    {
+        constant_time,
+        linear_time
+    };
+
+    template <typename C>
+    constexpr Access access_cost()
+    {
+        if constexpr (IsBitset_v<C> || std::ranges::random_access_range<C>)
+            return Access::constant_time;
+        else
+            return Access::linear_time;
+    }
+
+    template <std::ranges::forward_range R>
+    decltype(auto) get_nth(R& range, size_t nth)
+    {
+        return *std::ranges::next(std::ranges::begin(range), static_cast<std::ranges::range_difference_t<R>>(nth));
+    }
+
+    // the own operator[] of a container is preferred - std::vector<bool> finds the word with unsigned arithmetic
+    template <std::ranges::random_access_range R>
+    decltype(auto) get_nth(R& range, size_t nth)
+    {
+        if constexpr (requires { range[nth]; })
+            return range[nth];
+        else
+            return std::ranges::begin(range)[static_cast<std::ranges::range_difference_t<R>>(nth)];
+    }
+
+    // operator[] reads a single word without the range check of test()
+    template <typename B>
+        requires IsBitset_v<B>
+    decltype(auto) get_nth(B& bits, size_t nth)
+    {
+        return bits[nth];
+    }
+} // namespace TraitsDriven
+
+#endif // TYPE_DEDUCTION_GET_NTH_HPP
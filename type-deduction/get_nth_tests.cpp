@@ -0,0 +1,162 @@
+#include "get_nth.hpp"
+
+#include <array>
+#include <bitset>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <deque>
+#include <forward_list>
+#include <list>
+#include <ranges>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace std::literals;
+using TraitsDriven::get_nth;
+
+TEST_CASE("get_nth - access cost")
+{
+    using TraitsDriven::Access;
+    using TraitsDriven::access_cost;
+
+    static_assert(access_cost<std::vector<int>>() == Access::constant_time);
+    static_assert(access_cost<std::vector<bool>>() == Access::constant_time);
+    static_assert(access_cost<std::deque<int>>() == Access::constant_time);
+    static_assert(access_cost<int[10]>() == Access::constant_time);
+    static_assert(access_cost<std::bitset<100>>() == Access::constant_time);
+    static_assert(access_cost<std::list<int>>() == Access::linear_time);
+    static_assert(access_cost<std::forward_list<int>>() == Access::linear_time);
+}
+
+TEST_CASE("get_nth - result refers to the item")
+{
+    SECTION("references")
+    {
+        std::vector<std::string> words = {"one", "two", "three"};
+        static_assert(std::is_same_v<decltype(get_nth(words, 1)), std::string&>);
+        get_nth(words, 1) = "two-2";
+        CHECK(words[1] == "two-2"s);
+
+        const auto& cwords = words;
+        static_assert(std::is_same_v<decltype(get_nth(cwords, 1)), const std::string&>);
+
+        int tab[10] = {1, 2, 3, 4};
+        get_nth(tab, 5) = 665;
+        CHECK(tab[5] == 665);
+    }
+
+    SECTION("list")
+    {
+        std::list<int> lst = {1, 2, 3, 4};
+        static_assert(std::is_same_v<decltype(get_nth(lst, 2)), int&>);
+        get_nth(lst, 2) = 42;
+        CHECK(lst == std::list{1, 2, 42, 4});
+
+        std::forward_list<int> flst = {1, 2, 3};
+        CHECK(get_nth(flst, 2) == 3);
+    }
+
+    SECTION("views")
+    {
+        std::vector vec = {1, 2, 3, 4, 5};
+        auto evens = vec | std::views::filter([](int x) { return x % 2 == 0; });
+        get_nth(evens, 1) = 40;
+        CHECK(vec[3] == 40);
+    }
+
+    SECTION("proxies of bits")
+    {
+        std::vector<bool> vec_bool = {1, 1, 0, 0};
+        static_assert(std::is_same_v<decltype(get_nth(vec_bool, 2)), std::vector<bool>::reference>);
+        get_nth(vec_bool, 2) = true;
+        CHECK(vec_bool[2] == true);
+
+        std::bitset<130> bits;
+        static_assert(std::is_same_v<decltype(get_nth(bits, 0)), std::bitset<130>::reference>);
+        get_nth(bits, 129) = true;
+        CHECK(bits.test(129));
+
+        const auto& cbits = bits;
+        static_assert(std::is_same_v<decltype(get_nth(cbits, 0)), bool>);
+        CHECK(get_nth(cbits, 129));
+        CHECK(!get_nth(cbits, 128));
+    }
+}
+
+TEST_CASE("get_nth - no abstraction penalty", "[.][benchmark]")
+{
+    const size_t size = 10'000'000;
+
+    std::vector<int> ints(size, 1);
+    std::vector<bool> bools(size, true);
+    auto bits = std::make_unique<std::bitset<size>>();
+    bits->set();
+    std::list<int> lst(1'000, 1);
+
+    BENCHMARK("vector<int> - operator[]")
+    {
+        long sum = 0;
+        for (size_t i = 0; i < size; ++i)
+            sum += ints[i];
+        return sum;
+    };
+
+    BENCHMARK("vector<int> - get_nth")
+    {
+        long sum = 0;
+        for (size_t i = 0; i < size; ++i)
+            sum += get_nth(ints, i);
+        return sum;
+    };
+
+    BENCHMARK("vector<bool> - operator[]")
+    {
+        long sum = 0;
+        for (size_t i = 0; i < size; ++i)
+            sum += bools[i];
+        return sum;
+    };
+
+    BENCHMARK("vector<bool> - get_nth")
+    {
+        long sum = 0;
+        for (size_t i = 0; i < size; ++i)
+            sum += get_nth(bools, i);
+        return sum;
+    };
+
+    BENCHMARK("bitset - test()")
+    {
+        const auto& cbits = *bits;
+        long sum = 0;
+        for (size_t i = 0; i < size; ++i)
+            sum += cbits.test(i);
+        return sum;
+    };
+
+    BENCHMARK("bitset - get_nth")
+    {
+        const auto& cbits = *bits;
+        long sum = 0;
+        for (size_t i = 0; i < size; ++i)
+            sum += get_nth(cbits, i);
+        return sum;
+    };
+
+    BENCHMARK("list - std::next")
+    {
+        long sum = 0;
+        for (size_t i = 0; i < lst.size(); ++i)
+            sum += *std::next(lst.begin(), static_cast<long>(i));
+        return sum;
+    };
+
+    BENCHMARK("list - get_nth")
+    {
+        long sum = 0;
+        for (size_t i = 0; i < lst.size(); ++i)
+            sum += get_nth(lst, i);
+        return sum;
+    };
+}
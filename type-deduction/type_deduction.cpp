@@ -1,6 +1,10 @@
+#include "for_each.hpp"
+#include "get_nth.hpp"
+
 #include <algorithm>
 #include <catch2/catch_test_macros.hpp>
 #include <iostream>
+#include <list>
 #include <memory>
 #include <numeric>
 #include <string>
@@ -158,6 +162,14 @@ TEST_CASE("auto vs. decltype(auto)")
     std::vector<bool> vec_bool = {1, 1, 0, 0};
     DecltypeAuto::get_nth(vec_bool, 2) = true;
     CHECK(vec_bool[2] == true);
+
+    // any range - a reference or a proxy, O(1) for random access (see get_nth.hpp)
+    std::list<int> lst = {1, 2, 3, 4};
+    TraitsDriven::get_nth(lst, 3) = 42;
+    CHECK(lst.back() == 42);
+
+    TraitsDriven::get_nth(vec_bool, 3) = true;
+    CHECK(vec_bool[3] == true);
 }
 
 inline void print_int(int n)
@@ -165,14 +177,7 @@ inline void print_int(int n)
     std::cout << n << "\n";
 }
 
-template <typename InputIter, typename Function>
-void my_for_each(InputIter first, InputIter last, Function f)
-{
-    for(InputIter it = first; it != last; ++it)
-    {
-        f(*it);
-    }
-}
+// my_for_each is defined in for_each.hpp - with execution policies
 
 template <typename F, typename... Args>
 decltype(auto) call_wrapper(F f, Args&&... args)
@@ -192,4 +197,7 @@ TEST_CASE("template functions & functions as params")
     std::cout << "---\n";
 
     my_for_each(vec.begin(), vec.end(), print_int);
+
+    my_for_each(Execution::par, vec.begin(), vec.end(), f);
+    CHECK(vec == std::vector{4, 8, 12, 16});
 }
\ No newline at end of file
@@ -0,0 +1,58 @@
+#ifndef TYPE_TRAITS_CALL_TRAITS_HPP
+#define TYPE_TRAITS_CALL_TRAITS_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+/////////////////////////////////////////////////////////////////
+// CallTraits - the cheapest way to pass a read-only argument of type T
+//
+// Objects that the ABI passes in registers are passed by value: no copy
+// to the stack & no indirection in the callee. Everything else is passed
+// by const reference. The Itanium C++ ABI (gcc, clang) uses registers for
+// objects up to two eightbytes with trivial copy/move constructors and
+// a trivial destructor; the Microsoft x64 ABI only for objects up to 8 bytes.
+
+namespace CallTraitsDetail
+{
+#ifdef _MSC_VER
+    constexpr size_t max_register_size = sizeof(void*);
+#else
+    constexpr size_t max_register_size = 2 * sizeof(void*);
+#endif
+} // namespace CallTraitsDetail
+
+template <typename T>
+struct CallTraits
+{
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+
+    static constexpr bool pass_by_value = std::is_trivially_copy_constructible_v<T>
+        && std::is_trivially_destructible_v<T>
+        && sizeof(T) <= CallTraitsDetail::max_register_size;
+
+    using param_type = std::conditional_t<pass_by_value, const T, const T&>;
+};
+
+// references are passed as they are
+template <typename T>
+struct CallTraits<T&>
+{
+    using value_type = T&;
+    using reference = T&;
+    using const_reference = const T&;
+
+    static constexpr bool pass_by_value = false;
+
+    using param_type = T&;
+};
+
+template <typename T>
+using param_t = typename CallTraits<T>::param_type;
+
+template <typename T>
+concept PassedByValue = CallTraits<T>::pass_by_value;
+
+#endif // TYPE_TRAITS_CALL_TRAITS_HPP
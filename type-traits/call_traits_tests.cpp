@@ -0,0 +1,127 @@
+#include "call_traits.hpp"
+
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    struct Point
+    {
+        double x, y;
+    };
+
+    struct CopyCounter
+    {
+        inline static int copies = 0;
+
+        std::array<char, 64> data{};
+
+        CopyCounter() = default;
+
+        CopyCounter(const CopyCounter& other)
+            : data{other.data}
+        {
+            ++copies;
+        }
+    };
+
+    template <typename T>
+    int copies_when_passed(param_t<T>)
+    {
+        return CopyCounter::copies;
+    }
+} // namespace
+
+TEST_CASE("CallTraits")
+{
+    static_assert(std::is_same_v<param_t<int>, const int>);
+    static_assert(std::is_same_v<param_t<Point>, const Point>);
+    static_assert(std::is_same_v<param_t<std::string_view>, const std::string_view>);
+    static_assert(std::is_same_v<param_t<std::pair<int, int>>, const std::pair<int, int>>);
+
+    static_assert(std::is_same_v<param_t<std::string>, const std::string&>);
+    static_assert(std::is_same_v<param_t<std::unique_ptr<int>>, const std::unique_ptr<int>&>); // non-trivial destructor
+    static_assert(std::is_same_v<param_t<std::array<double, 4>>, const std::array<double, 4>&>);
+    static_assert(std::is_same_v<param_t<int&>, int&>);
+
+    static_assert(PassedByValue<double>);
+    static_assert(!PassedByValue<std::vector<int>>);
+
+    CopyCounter counter;
+    CopyCounter::copies = 0;
+    CHECK(copies_when_passed<CopyCounter>(counter) == 0);
+}
+
+namespace
+{
+    using Large = std::array<double, 32>;
+
+    // noipa - gcc would otherwise change the calling convention of local functions
+    [[gnu::noipa]] double by_value(Large data)
+    {
+        return data[0] + data[31];
+    }
+
+    [[gnu::noipa]] double by_param_t(param_t<Large> data)
+    {
+        return data[0] + data[31];
+    }
+
+    [[gnu::noipa]] double by_const_ref(const Point& pt)
+    {
+        return pt.x * pt.y;
+    }
+
+    [[gnu::noipa]] double by_param_t(param_t<Point> pt)
+    {
+        return pt.x * pt.y;
+    }
+} // namespace
+
+TEST_CASE("CallTraits - passing conventions", "[.][benchmark]")
+{
+    constexpr int count = 1'000'000;
+
+    Large large{};
+    std::iota(large.begin(), large.end(), 0.0);
+    Point pt{1.0, 2.0};
+
+    BENCHMARK("large - by value (copy of 256 bytes)")
+    {
+        double result = 0;
+        for (int i = 0; i < count; ++i)
+            result += by_value(large);
+        return result;
+    };
+
+    BENCHMARK("large - param_t (const ref)")
+    {
+        double result = 0;
+        for (int i = 0; i < count; ++i)
+            result += by_param_t(large);
+        return result;
+    };
+
+    BENCHMARK("small - const ref (loads through pointer)")
+    {
+        double result = 0;
+        for (int i = 0; i < count; ++i)
+            result += by_const_ref(pt);
+        return result;
+    };
+
+    BENCHMARK("small - param_t (by value in registers)")
+    {
+        double result = 0;
+        for (int i = 0; i < count; ++i)
+            result += by_param_t(pt);
+        return result;
+    };
+}
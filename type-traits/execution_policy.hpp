@@ -0,0 +1,42 @@
+#ifndef TYPE_TRAITS_EXECUTION_POLICY_HPP
+#define TYPE_TRAITS_EXECUTION_POLICY_HPP
+
+#include <type_traits>
+
+/////////////////////////////////////////////////////////////////
+// Execution policies - the same meaning as std::execution policies
+
+namespace Execution
+{
+    struct SequencedPolicy
+    { };
+
+    struct UnsequencedPolicy
+    { };
+
+    struct ParallelPolicy
+    { };
+
+    struct ParallelUnsequencedPolicy
+    { };
+
+    inline constexpr SequencedPolicy seq{};
+    inline constexpr UnsequencedPolicy unseq{};
+    inline constexpr ParallelPolicy par{};
+    inline constexpr ParallelUnsequencedPolicy par_unseq{};
+
+    template <typename T>
+    constexpr bool IsExecutionPolicy_v = std::is_same_v<T, SequencedPolicy> || std::is_same_v<T, UnsequencedPolicy>
+        || std::is_same_v<T, ParallelPolicy> || std::is_same_v<T, ParallelUnsequencedPolicy>;
+
+    template <typename T>
+    constexpr bool IsParallel_v = std::is_same_v<T, ParallelPolicy> || std::is_same_v<T, ParallelUnsequencedPolicy>;
+
+    template <typename T>
+    constexpr bool IsUnsequenced_v = std::is_same_v<T, UnsequencedPolicy> || std::is_same_v<T, ParallelUnsequencedPolicy>;
+
+    template <typename T>
+    concept ExecutionPolicy = IsExecutionPolicy_v<std::remove_cvref_t<T>>;
+} // namespace Execution
+
+#endif // TYPE_TRAITS_EXECUTION_POLICY_HPP
@@ -0,0 +1,212 @@
+#ifndef TYPE_TRAITS_MIN_MAX_HPP
+#define TYPE_TRAITS_MIN_MAX_HPP
+
+#include "call_traits.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+
+/////////////////////////////////////////////////////////////////
+// MinMax - max_value & min_value selected by concepts
+//
+// - values passed in registers (arithmetic types, small trivial types) are
+//   taken & returned by value - a < b ? b : a compiles to maxsd/cmov
+// - other values are taken by const reference & the result refers to one
+//   of the arguments (like std::max)
+// - pointers (raw or smart) are compared by pointed values - the result refers
+//   to the larger pointed value
+// - C strings are compared as strings
+//
+// Like std::max & std::min, both return a when a & b are equivalent.
+
+namespace MinMax
+{
+    template <typename T>
+    concept CString = std::is_pointer_v<T> && std::same_as<std::remove_cv_t<std::remove_pointer_t<T>>, char>;
+
+    template <typename T>
+    concept Dereferenceable = !CString<T> && requires(const T& ptr) {
+        *ptr;
+        ptr == nullptr;
+        requires std::totally_ordered<std::remove_cvref_t<decltype(*ptr)>>;
+    };
+
+    template <typename T>
+    concept OrderedValue = std::totally_ordered<T> && !Dereferenceable<T> && !CString<T>;
+
+    template <OrderedValue T>
+        requires PassedByValue<T>
+    constexpr T max_value(T a, T b)
+    {
+        return a < b ? b : a;
+    }
+
+    template <OrderedValue T>
+        requires PassedByValue<T>
+    constexpr T min_value(T a, T b)
+    {
+        return b < a ? b : a;
+    }
+
+    template <OrderedValue T>
+        requires(!PassedByValue<T>)
+    constexpr const T& max_value(const T& a, const T& b)
+    {
+        return a < b ? b : a;
+    }
+
+    template <OrderedValue T>
+        requires(!PassedByValue<T>)
+    constexpr const T& min_value(const T& a, const T& b)
+    {
+        return b < a ? b : a;
+    }
+
+    // one of the pointers is selected (cmov) & dereferenced once
+    template <Dereferenceable P>
+    constexpr const auto& max_value(const P& a, const P& b)
+    {
+        assert(a != nullptr);
+        assert(b != nullptr);
+
+        const P& result = *a < *b ? b : a;
+        return *result;
+    }
+
+    template <Dereferenceable P>
+    constexpr const auto& min_value(const P& a, const P& b)
+    {
+        assert(a != nullptr);
+        assert(b != nullptr);
+
+        const P& result = *b < *a ? b : a;
+        return *result;
+    }
+
+    template <CString S>
+    constexpr S max_value(S a, S b)
+    {
+        return std::string_view{a} < std::string_view{b} ? b : a;
+    }
+
+    template <CString S>
+    constexpr S min_value(S a, S b)
+    {
+        return std::string_view{b} < std::string_view{a} ? b : a;
+    }
+
+    /////////////////////////////////////////////////////////////////
+    // max_element - the first largest item of a contiguous range of numbers
+    //
+    // The range is read once in chunks that fit in L1 cache. The largest value
+    // of a chunk is a max per lane - the loop is vectorized. Only the chunk
+    // holding the largest value is searched again for its position.
+    // A NaN hides the items after it from a lane (comparisons with NaN are
+    // false) - chunks of floating point numbers are checked for NaNs (x != x)
+    // and ranges with NaNs fall back to std::ranges::max_element.
+
+    namespace Detail
+    {
+        template <typename T>
+        constexpr size_t lanes = sizeof(T) < 32 ? 32 / sizeof(T) : 1; // one 256-bit register
+
+        template <typename T>
+        constexpr T max_of(const T* items, size_t size)
+        {
+            constexpr size_t lanes = Detail::lanes<T>;
+            const size_t vectorized_size = size - size % lanes;
+
+            T largest = items[0];
+            if (vectorized_size > 0)
+            {
+                std::array<T, lanes> partial;
+                std::copy_n(items, lanes, partial.begin());
+
+                for (size_t i = lanes; i < vectorized_size; i += lanes)
+                    for (size_t lane = 0; lane < lanes; ++lane)
+                        partial[lane] = max_value(partial[lane], items[i + lane]);
+
+                for (const auto& value : partial)
+                    largest = max_value(largest, value);
+            }
+            for (size_t i = vectorized_size; i < size; ++i)
+                largest = max_value(largest, items[i]);
+
+            return largest;
+        }
+
+        template <typename T>
+        constexpr bool has_nan(const T* items, size_t size)
+        {
+            if constexpr (!std::is_floating_point_v<T>)
+                return false;
+            else
+            {
+                constexpr size_t lanes = Detail::lanes<T>;
+                const size_t vectorized_size = size - size % lanes;
+
+                // flags as wide as the items - the comparison results fill the vector lanes
+                using Flag = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+
+                std::array<Flag, lanes> unordered{};
+                for (size_t i = 0; i < vectorized_size; i += lanes)
+                    for (size_t lane = 0; lane < lanes; ++lane)
+                        unordered[lane] |= items[i + lane] != items[i + lane];
+
+                bool found = std::ranges::any_of(unordered, [](Flag nan) { return nan != 0; });
+                for (size_t i = vectorized_size; i < size; ++i)
+                    found |= items[i] != items[i];
+
+                return found;
+            }
+        }
+    } // namespace Detail
+
+    template <typename R>
+    concept ContiguousArithmeticRange = std::ranges::contiguous_range<R> && std::ranges::sized_range<R>
+        && std::is_arithmetic_v<std::ranges::range_value_t<R>>;
+
+    template <ContiguousArithmeticRange R>
+    constexpr std::ranges::iterator_t<R> max_element(R& range)
+    {
+        using T = std::ranges::range_value_t<R>;
+        constexpr size_t chunk_size = 16 * 1024 / sizeof(T);
+
+        const T* items = std::ranges::data(range);
+        const size_t size = std::ranges::size(range);
+        if (size == 0)
+            return std::ranges::end(range);
+
+        T largest = items[0];
+        size_t largest_chunk = 0;
+        for (size_t chunk = 0; chunk < size; chunk += chunk_size)
+        {
+            const size_t chunk_length = std::min(chunk_size, size - chunk);
+            if (Detail::has_nan(items + chunk, chunk_length))
+                return std::ranges::max_element(range);
+
+            const T chunk_max = Detail::max_of(items + chunk, chunk_length);
+            if (largest < chunk_max)
+            {
+                largest = chunk_max;
+                largest_chunk = chunk;
+            }
+        }
+
+        const size_t chunk_end = std::min(largest_chunk + chunk_size, size);
+        for (size_t position = largest_chunk; position < chunk_end; ++position)
+            if (items[position] == largest)
+                return std::ranges::begin(range) + position;
+
+        return std::ranges::max_element(range); // not reached - the largest value is in its chunk
+    }
+} // namespace MinMax
+
+#endif // TYPE_TRAITS_MIN_MAX_HPP
@@ -0,0 +1,202 @@
+#include "min_max.hpp"
+
+#include <algorithm>
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    struct Version
+    {
+        int major, minor;
+
+        auto operator<=>(const Version&) const = default;
+    };
+
+    struct Name
+    {
+        std::string value;
+        int id;
+
+        bool operator==(const Name& other) const
+        {
+            return value == other.value;
+        }
+
+        auto operator<=>(const Name& other) const
+        {
+            return value <=> other.value;
+        }
+    };
+} // namespace
+
+TEST_CASE("MinMax - values")
+{
+    static_assert(std::is_same_v<decltype(MinMax::max_value(1, 2)), int>);
+    static_assert(std::is_same_v<decltype(MinMax::max_value(Version{}, Version{})), Version>);
+    static_assert(std::is_same_v<decltype(MinMax::max_value(Name{}, Name{})), const Name&>);
+    static_assert(MinMax::max_value(42, 665) == 665);
+    static_assert(MinMax::min_value(42, 665) == 42);
+
+    CHECK(MinMax::max_value(4.2, 66.5) == 66.5);
+    CHECK(MinMax::min_value(4.2, 66.5) == 4.2);
+    CHECK(MinMax::max_value(Version{1, 2}, Version{1, 10}) == Version{1, 10});
+
+    SECTION("heavy values are returned by reference")
+    {
+        Name a{"same", 1};
+        Name b{"same", 2};
+        Name c{"text", 3};
+
+        CHECK(&MinMax::max_value(a, c) == &c);
+        CHECK(&MinMax::min_value(a, c) == &a);
+
+        // equivalent arguments - a is returned, like std::max & std::min
+        CHECK(MinMax::max_value(a, b).id == 1);
+        CHECK(MinMax::min_value(a, b).id == 1);
+    }
+}
+
+TEST_CASE("MinMax - pointers")
+{
+    int x = 10;
+    int y = 665;
+
+    CHECK(MinMax::max_value(&x, &y) == 665);
+    CHECK(&MinMax::max_value(&x, &y) == &y);
+    CHECK(MinMax::min_value(&x, &y) == 10);
+
+    auto a = std::make_shared<std::string>("ala");
+    auto b = std::make_shared<std::string>("ola");
+    CHECK(&MinMax::max_value(a, b) == b.get());
+    CHECK(MinMax::min_value(std::make_unique<int>(1), std::make_unique<int>(2)) == 1);
+}
+
+TEST_CASE("MinMax - C strings")
+{
+    const char* ala = "ala";
+    const char* ola = "ola";
+
+    CHECK(MinMax::max_value(ala, ola) == ola);
+    CHECK(MinMax::min_value(ala, ola) == ala);
+
+    char text[] = "alan";
+    CHECK(MinMax::max_value<char*>(text, text + 1) == "lan"s);
+}
+
+TEST_CASE("MinMax - max_element")
+{
+    SECTION("empty range")
+    {
+        std::vector<int> empty;
+        CHECK(MinMax::max_element(empty) == empty.end());
+    }
+
+    SECTION("first of equal largest items")
+    {
+        std::vector<int> values(1001, 0);
+        values[700] = 5;
+        values[300] = 5;
+        values[1000] = 4;
+
+        CHECK(MinMax::max_element(values) - values.begin() == 300);
+    }
+
+    SECTION("first of equal largest items in different chunks")
+    {
+        std::vector<int> values(100'000, -1);
+        values[90'000] = 7;
+        values[50'001] = 7;
+        values[99'999] = 6;
+
+        CHECK(MinMax::max_element(values) - values.begin() == 50'001);
+    }
+
+    SECTION("largest item in the remainder")
+    {
+        std::array<int8_t, 35> values{};
+        values[34] = 1;
+        CHECK(MinMax::max_element(values) - values.begin() == 34);
+    }
+
+    SECTION("same result as std::max_element")
+    {
+        std::mt19937 rnd{665};
+        std::uniform_real_distribution<double> distribution{-1e6, 1e6};
+
+        for (size_t size : {1, 3, 4, 17, 1000})
+        {
+            std::vector<double> values(size);
+            std::ranges::generate(values, [&] { return distribution(rnd); });
+
+            CHECK(MinMax::max_element(values) == std::ranges::max_element(values));
+        }
+    }
+
+    SECTION("NaN")
+    {
+        std::vector<float> values{std::numeric_limits<float>::quiet_NaN(), 1.0f, 3.0f, 2.0f};
+        values.resize(64, 0.0f);
+
+        CHECK(MinMax::max_element(values) == std::ranges::max_element(values));
+    }
+
+    SECTION("NaN in a lane - items after it are not hidden")
+    {
+        std::vector<float> values(64, 1.0f);
+        values[1] = std::numeric_limits<float>::quiet_NaN();
+        values[9] = 100.0f;
+
+        CHECK(MinMax::max_element(values) == std::ranges::max_element(values));
+        CHECK(MinMax::max_element(values) - values.begin() == 9);
+    }
+
+    SECTION("NaN in a later chunk")
+    {
+        std::vector<double> values(10'000, 1.0);
+        values[9'000] = std::numeric_limits<double>::quiet_NaN();
+        values[9'001] = 2.0;
+
+        CHECK(MinMax::max_element(values) == std::ranges::max_element(values));
+    }
+}
+
+TEST_CASE("MinMax - max_element of 10^8 items", "[.][benchmark]")
+{
+    const size_t size = 100'000'000;
+
+    std::mt19937 rnd{665};
+    std::vector<int> ints(size);
+    std::ranges::generate(ints, [&] { return static_cast<int>(rnd() >> 1); });
+    std::vector<float> floats(size);
+    std::ranges::transform(ints, floats.begin(), [](int x) { return static_cast<float>(x); });
+
+    BENCHMARK("int - std::max_element")
+    {
+        return *std::max_element(ints.begin(), ints.end());
+    };
+
+    BENCHMARK("int - MinMax::max_element")
+    {
+        return *MinMax::max_element(ints);
+    };
+
+    BENCHMARK("float - std::max_element")
+    {
+        return *std::max_element(floats.begin(), floats.end());
+    };
+
+    BENCHMARK("float - MinMax::max_element")
+    {
+        return *MinMax::max_element(floats);
+    };
+}
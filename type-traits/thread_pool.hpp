@@ -0,0 +1,179 @@
+#ifndef TYPE_TRAITS_THREAD_POOL_HPP
+#define TYPE_TRAITS_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////
+// ThreadPool - reusable worker threads with work stealing
+//
+// Every worker has its own queue: it takes its newest task first (hot in its
+// cache) and, when the queue is empty, steals the oldest task of another
+// worker. Tasks submitted from outside are spread over the queues round-robin;
+// a task submitted by a worker goes to its own queue.
+//
+// A thread waiting for its tasks should help with run_pending_task() instead
+// of blocking - this keeps nested parallel calls from deadlocking.
+//
+// Tasks still queued when the pool is destroyed are run before its workers finish.
+
+class ThreadPool
+{
+public:
+    using Task = std::function<void()>;
+
+    explicit ThreadPool(size_t thread_count = std::max(1u, std::thread::hardware_concurrency()))
+    {
+        queues_.reserve(std::max(thread_count, size_t{1}));
+        for (size_t i = 0; i < std::max(thread_count, size_t{1}); ++i)
+            queues_.push_back(std::make_unique<WorkQueue>());
+
+        workers_.reserve(thread_count);
+        for (size_t i = 0; i < thread_count; ++i)
+            workers_.emplace_back([this, i] { run_worker(i); });
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard lk{wake_mtx_};
+            stop_ = true;
+        }
+        wake_.notify_all();
+    }
+
+    size_t size() const
+    {
+        return workers_.size();
+    }
+
+    void submit(Task task)
+    {
+        const size_t queue = this_worker_.pool == this
+            ? this_worker_.index
+            : next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+
+        // counted while the queue is still locked - the task cannot be taken (and uncounted) before
+        {
+            std::lock_guard lk{queues_[queue]->mtx};
+            queues_[queue]->tasks.push_back(std::move(task));
+
+            std::lock_guard wake_lk{wake_mtx_};
+            ++pending_;
+        }
+        wake_.notify_one();
+    }
+
+    // runs one queued task in the calling thread - false when there is none
+    bool run_pending_task()
+    {
+        const size_t index = this_worker_.pool == this ? this_worker_.index : 0;
+
+        if (auto task = take_task(index))
+        {
+            (*task)();
+            return true;
+        }
+        return false;
+    }
+
+private:
+    struct WorkQueue
+    {
+        std::mutex mtx;
+        std::deque<Task> tasks;
+    };
+
+    struct WorkerId
+    {
+        const ThreadPool* pool;
+        size_t index;
+    };
+
+    // zero-initialized - threads other than workers belong to no pool
+    inline static thread_local WorkerId this_worker_;
+
+    std::vector<std::unique_ptr<WorkQueue>> queues_;
+    std::atomic<size_t> next_queue_{0};
+
+    std::mutex wake_mtx_;
+    std::condition_variable wake_;
+    size_t pending_{0};
+    bool stop_{false};
+
+    std::vector<std::jthread> workers_; // joined first on destruction
+
+    std::optional<Task> take_task(size_t index)
+    {
+        std::optional<Task> task;
+
+        // own queue - the newest task
+        {
+            std::lock_guard lk{queues_[index]->mtx};
+            if (!queues_[index]->tasks.empty())
+            {
+                task = std::move(queues_[index]->tasks.back());
+                queues_[index]->tasks.pop_back();
+            }
+        }
+
+        // other queues - the oldest task
+        for (size_t i = 1; !task && i < queues_.size(); ++i)
+        {
+            auto& victim = *queues_[(index + i) % queues_.size()];
+            std::lock_guard lk{victim.mtx};
+            if (!victim.tasks.empty())
+            {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+            }
+        }
+
+        if (task)
+        {
+            std::lock_guard lk{wake_mtx_};
+            --pending_;
+        }
+
+        return task;
+    }
+
+    void run_worker(size_t index)
+    {
+        this_worker_ = WorkerId{this, index};
+
+        while (true)
+        {
+            if (auto task = take_task(index))
+            {
+                (*task)();
+                continue;
+            }
+
+            std::unique_lock lk{wake_mtx_};
+            wake_.wait(lk, [this] { return stop_ || pending_ > 0; });
+            if (stop_ && pending_ == 0)
+                return;
+        }
+    }
+};
+
+inline ThreadPool& default_thread_pool()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+#endif // TYPE_TRAITS_THREAD_POOL_HPP
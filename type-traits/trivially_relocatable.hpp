@@ -0,0 +1,72 @@
+#ifndef TYPE_TRAITS_TRIVIALLY_RELOCATABLE_HPP
+#define TYPE_TRAITS_TRIVIALLY_RELOCATABLE_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+/////////////////////////////////////////////////////////////////
+// IsTriviallyRelocatable - moving an object to a new address & destroying
+// the source is equivalent to copying its bytes
+//
+// True for trivially copyable types. Types owning resources through pointers
+// to other objects may opt in with a specialization. Types holding pointers
+// into themselves must not - e.g. std::string of libstdc++ (SSO buffer) or
+// std::list (sentinel node).
+
+template <typename T>
+struct IsTriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<T>>
+{ };
+
+template <typename T, typename Deleter>
+struct IsTriviallyRelocatable<std::unique_ptr<T, Deleter>> : IsTriviallyRelocatable<Deleter>
+{ };
+
+template <typename T>
+struct IsTriviallyRelocatable<std::shared_ptr<T>> : std::true_type
+{ };
+
+template <typename T>
+struct IsTriviallyRelocatable<std::weak_ptr<T>> : std::true_type
+{ };
+
+template <typename T>
+constexpr bool IsTriviallyRelocatable_v = IsTriviallyRelocatable<T>::value;
+
+/////////////////////////////////////////////////////////////////
+// uninitialized_relocate - moves [first, last) into uninitialized memory
+// at dest and ends the lifetime of the source objects
+//
+// Trivially relocatable objects are copied with a single memcpy. Other objects
+// are moved (copied if their move may throw) and destroyed. When an exception
+// is thrown, the objects already built at dest are destroyed and the source
+// range is still alive - unchanged if the objects were copied, but for
+// move-only types whose move may throw the items processed so far are left
+// moved-from (basic guarantee only).
+
+template <typename T>
+T* uninitialized_relocate(T* first, T* last, T* dest)
+{
+    const auto count = static_cast<size_t>(last - first);
+
+    if constexpr (IsTriviallyRelocatable_v<T>)
+    {
+        if (count > 0)
+            std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first), count * sizeof(T));
+        return dest + count;
+    }
+    else
+    {
+        T* result;
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+            result = std::uninitialized_move(first, last, dest);
+        else
+            result = std::uninitialized_copy(first, last, dest);
+
+        std::destroy(first, last);
+        return result;
+    }
+}
+
+#endif // TYPE_TRAITS_TRIVIALLY_RELOCATABLE_HPP
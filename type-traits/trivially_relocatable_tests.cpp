@@ -0,0 +1,94 @@
+#include "trivially_relocatable.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    struct Point
+    {
+        int x, y;
+    };
+
+    // owns a heap buffer - never points into itself
+    class Buffer
+    {
+        std::unique_ptr<char[]> data_;
+        size_t size_;
+
+    public:
+        explicit Buffer(size_t size)
+            : data_{std::make_unique<char[]>(size)}
+            , size_{size}
+        { }
+
+        Buffer(Buffer&&) noexcept = default;
+        Buffer& operator=(Buffer&&) noexcept = default;
+
+        size_t size() const
+        {
+            return size_;
+        }
+    };
+} // namespace
+
+// opt-in
+template <>
+struct IsTriviallyRelocatable<Buffer> : std::true_type
+{ };
+
+TEST_CASE("IsTriviallyRelocatable")
+{
+    static_assert(IsTriviallyRelocatable_v<int>);
+    static_assert(IsTriviallyRelocatable_v<Point>);
+    static_assert(IsTriviallyRelocatable_v<std::unique_ptr<int>>);
+    static_assert(IsTriviallyRelocatable_v<std::shared_ptr<std::string>>);
+    static_assert(IsTriviallyRelocatable_v<Buffer>);
+
+    static_assert(!IsTriviallyRelocatable_v<std::string>);
+    static_assert(!IsTriviallyRelocatable_v<std::unique_ptr<int, std::function<void(int*)>>>);
+}
+
+TEST_CASE("uninitialized_relocate")
+{
+    std::allocator<std::unique_ptr<int>> pointer_alloc;
+    std::allocator<std::string> string_alloc;
+
+    SECTION("memcpy for trivially relocatable types")
+    {
+        auto* source = pointer_alloc.allocate(3);
+        auto* target = pointer_alloc.allocate(3);
+        for (int i = 0; i < 3; ++i)
+            std::construct_at(source + i, std::make_unique<int>(i));
+
+        auto* end = uninitialized_relocate(source, source + 3, target);
+
+        CHECK(end == target + 3);
+        CHECK(*target[2] == 2);
+
+        std::destroy(target, end);
+        pointer_alloc.deallocate(source, 3);
+        pointer_alloc.deallocate(target, 3);
+    }
+
+    SECTION("move & destroy for other types")
+    {
+        auto* source = string_alloc.allocate(2);
+        auto* target = string_alloc.allocate(2);
+        std::construct_at(source, "a text longer than the small string buffer");
+        std::construct_at(source + 1, "short");
+
+        auto* end = uninitialized_relocate(source, source + 2, target);
+
+        CHECK(target[0] == "a text longer than the small string buffer");
+        CHECK(target[1] == "short");
+
+        std::destroy(target, end);
+        string_alloc.deallocate(source, 2);
+        string_alloc.deallocate(target, 2);
+    }
+}
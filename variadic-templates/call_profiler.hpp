@@ -0,0 +1,339 @@
+#ifndef VARIADIC_TEMPLATES_CALL_PROFILER_HPP
+#define VARIADIC_TEMPLATES_CALL_PROFILER_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define CALL_PROFILING_HAS_RDTSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CALL_PROFILING_HAS_RDTSC 1
+#endif
+
+// -DCALL_PROFILING_ENABLED=0 removes instrumentation from Profiling::call_wrapper
+#ifndef CALL_PROFILING_ENABLED
+#define CALL_PROFILING_ENABLED 1
+#endif
+
+namespace Profiling
+{
+    constexpr bool enabled = CALL_PROFILING_ENABLED;
+
+    template <size_t N>
+    struct FixedString
+    {
+        char value[N];
+
+        constexpr FixedString(const char (&str)[N])
+        {
+            std::copy_n(str, N, value);
+        }
+
+        constexpr std::string_view view() const
+        {
+            return {value, N - 1};
+        }
+    };
+
+    /////////////////////////////////////////////////////////////////
+    // TickClock - time stamp counter if available, steady_clock otherwise
+
+    struct TickClock
+    {
+#ifdef CALL_PROFILING_HAS_RDTSC
+        static constexpr std::string_view unit = "cycles";
+
+        static uint64_t now() noexcept
+        {
+            return __rdtsc();
+        }
+#else
+        static constexpr std::string_view unit = "ns";
+
+        static uint64_t now() noexcept
+        {
+            using namespace std::chrono;
+            return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+        }
+#endif
+    };
+
+    /////////////////////////////////////////////////////////////////
+    // Histogram - log2 buckets: bucket i counts latencies in [2^i, 2^(i+1))
+
+    constexpr size_t bucket_count = 64;
+    constexpr size_t max_call_sites = 256;
+
+    constexpr size_t bucket_of(uint64_t ticks)
+    {
+        return ticks == 0 ? 0 : static_cast<size_t>(std::bit_width(ticks)) - 1;
+    }
+
+    struct Histogram
+    {
+        std::array<std::atomic<uint64_t>, bucket_count> buckets{};
+
+        // only the owning thread writes - no read-modify-write instruction is needed
+        void record(uint64_t ticks)
+        {
+            auto& bucket = buckets[bucket_of(ticks)];
+            bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+    };
+
+    struct CallSiteReport
+    {
+        std::string name;
+        uint64_t calls{};
+        std::array<uint64_t, bucket_count> histogram{};
+    };
+
+    /////////////////////////////////////////////////////////////////
+    // CallProfiler - registry of call sites and per-thread histograms
+    //
+    // The hot path touches only histograms of the calling thread. The mutex is
+    // taken when a call site or a thread is seen for the first time, when a thread
+    // exits (its counts are merged into totals of finished threads) and by reports.
+
+    class CallProfiler
+    {
+        struct ThreadData
+        {
+            std::array<std::atomic<Histogram*>, max_call_sites> histograms{};
+            std::vector<std::unique_ptr<Histogram>> owned;
+        };
+
+        // thread_local - retires the data of a thread when the thread exits
+        class ThreadHandle
+        {
+            CallProfiler& profiler_;
+            ThreadData* data_;
+
+        public:
+            explicit ThreadHandle(CallProfiler& profiler)
+                : profiler_{profiler}
+                , data_{profiler.register_thread()}
+            { }
+
+            ThreadHandle(const ThreadHandle&) = delete;
+            ThreadHandle& operator=(const ThreadHandle&) = delete;
+
+            ~ThreadHandle()
+            {
+                profiler_.retire_thread(data_);
+            }
+
+            ThreadData& data() const
+            {
+                return *data_;
+            }
+        };
+
+        using Buckets = std::array<uint64_t, bucket_count>;
+
+        mutable std::mutex mtx_;
+        std::vector<std::string> sites_;
+        std::vector<std::unique_ptr<ThreadData>> threads_;
+        std::vector<Buckets> retired_; // counts of finished threads per call site
+
+        CallProfiler() = default;
+
+    public:
+        CallProfiler(const CallProfiler&) = delete;
+        CallProfiler& operator=(const CallProfiler&) = delete;
+
+        static CallProfiler& instance()
+        {
+            static CallProfiler profiler;
+            return profiler;
+        }
+
+        size_t register_site(std::string_view name)
+        {
+            std::lock_guard lk{mtx_};
+
+            auto it = std::ranges::find(sites_, name);
+            if (it != sites_.end())
+                return static_cast<size_t>(it - sites_.begin());
+
+            if (sites_.size() == max_call_sites)
+                throw std::length_error("Too many profiled call sites");
+
+            sites_.emplace_back(name);
+            retired_.emplace_back();
+            return sites_.size() - 1;
+        }
+
+        void record(size_t site, uint64_t ticks)
+        {
+            ThreadData& data = local();
+
+            Histogram* histogram = data.histograms[site].load(std::memory_order_relaxed);
+            if (!histogram) [[unlikely]]
+            {
+                histogram = data.owned.emplace_back(std::make_unique<Histogram>()).get();
+                data.histograms[site].store(histogram, std::memory_order_release);
+            }
+
+            histogram->record(ticks);
+        }
+
+        std::vector<CallSiteReport> report() const
+        {
+            std::lock_guard lk{mtx_};
+
+            std::vector<CallSiteReport> result(sites_.size());
+
+            for (size_t site = 0; site < sites_.size(); ++site)
+            {
+                result[site].name = sites_[site];
+                result[site].histogram = retired_[site];
+                for (uint64_t count : retired_[site])
+                    result[site].calls += count;
+
+                for (const auto& thread : threads_)
+                {
+                    const Histogram* histogram = thread->histograms[site].load(std::memory_order_acquire);
+                    if (!histogram)
+                        continue;
+
+                    for (size_t i = 0; i < bucket_count; ++i)
+                    {
+                        uint64_t count = histogram->buckets[i].load(std::memory_order_relaxed);
+                        result[site].histogram[i] += count;
+                        result[site].calls += count;
+                    }
+                }
+            }
+
+            return result;
+        }
+
+        void dump(std::ostream& out) const
+        {
+            for (const auto& site : report())
+            {
+                out << site.name << ": " << site.calls << " calls\n";
+
+                for (size_t i = 0; i < bucket_count; ++i)
+                {
+                    if (site.histogram[i] == 0)
+                        continue;
+
+                    out << "  [" << (i == 0 ? 0 : uint64_t{1} << i) << ", ";
+                    if (i + 1 < bucket_count)
+                        out << (uint64_t{2} << i);
+                    else
+                        out << "inf";
+                    out << ") " << TickClock::unit << ": " << site.histogram[i] << "\n";
+                }
+            }
+        }
+
+        // threads that have recorded calls & are still running
+        size_t thread_count() const
+        {
+            std::lock_guard lk{mtx_};
+            return threads_.size();
+        }
+
+        // counters updated concurrently with reset may keep their old values
+        void reset()
+        {
+            std::lock_guard lk{mtx_};
+
+            for (auto& buckets : retired_)
+                buckets.fill(0);
+
+            for (const auto& thread : threads_)
+                for (const auto& histogram : thread->histograms)
+                    if (Histogram* h = histogram.load(std::memory_order_acquire))
+                        for (auto& bucket : h->buckets)
+                            bucket.store(0, std::memory_order_relaxed);
+        }
+
+    private:
+        ThreadData& local()
+        {
+            thread_local ThreadHandle handle{*this};
+            return handle.data();
+        }
+
+        ThreadData* register_thread()
+        {
+            std::lock_guard lk{mtx_};
+            return threads_.emplace_back(std::make_unique<ThreadData>()).get();
+        }
+
+        void retire_thread(ThreadData* data)
+        {
+            std::lock_guard lk{mtx_};
+
+            for (size_t site = 0; site < sites_.size(); ++site)
+                if (const Histogram* histogram = data->histograms[site].load(std::memory_order_relaxed))
+                    for (size_t i = 0; i < bucket_count; ++i)
+                        retired_[site][i] += histogram->buckets[i].load(std::memory_order_relaxed);
+
+            std::erase_if(threads_, [data](const auto& thread) { return thread.get() == data; });
+        }
+    };
+
+    class ScopedTimer
+    {
+        size_t site_;
+        uint64_t start_;
+
+    public:
+        explicit ScopedTimer(size_t site)
+            : site_{site}
+            , start_{TickClock::now()}
+        { }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+        ~ScopedTimer()
+        {
+            CallProfiler::instance().record(site_, TickClock::now() - start_);
+        }
+    };
+
+    /////////////////////////////////////////////////////////////////
+    // call_wrapper - perfect forwarding with latency recorded per call site
+    //
+    // Profiling::call_wrapper<"parse">(parse, text);
+
+    template <FixedString Site, typename F, typename... Args>
+    decltype(auto) call_wrapper(F&& f, Args&&... args)
+    {
+        if constexpr (enabled)
+        {
+            static const size_t site = CallProfiler::instance().register_site(Site.view());
+
+            ScopedTimer timer{site};
+            return std::invoke(std::forward<F>(f), std::forward<Args>(args)...);
+        }
+        else
+        {
+            return std::invoke(std::forward<F>(f), std::forward<Args>(args)...);
+        }
+    }
+} // namespace Profiling
+
+#endif // VARIADIC_TEMPLATES_CALL_PROFILER_HPP
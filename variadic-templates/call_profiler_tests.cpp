@@ -0,0 +1,123 @@
+#include "call_profiler.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_all.hpp>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    int multiply(int a, int b)
+    {
+        return a * b;
+    }
+
+    const Profiling::CallSiteReport* find_site(const std::vector<Profiling::CallSiteReport>& report, std::string_view name)
+    {
+        auto it = std::ranges::find(report, name, &Profiling::CallSiteReport::name);
+        return it != report.end() ? &*it : nullptr;
+    }
+} // namespace
+
+TEST_CASE("Profiling::call_wrapper - perfect forwarding")
+{
+    CHECK(Profiling::call_wrapper<"multiply">(multiply, 6, 7) == 42);
+
+    std::vector<int> vec = {1, 2, 3};
+    auto&& ref = Profiling::call_wrapper<"vector::operator[]">([](std::vector<int>& v) -> int& { return v[1]; }, vec);
+    ref = 665;
+    CHECK(vec[1] == 665);
+
+    auto ptr = Profiling::call_wrapper<"make_unique">([](std::unique_ptr<int> p) { return p; }, std::make_unique<int>(42));
+    CHECK(*ptr == 42);
+}
+
+TEST_CASE("Profiling::call_wrapper - histograms per call site")
+{
+    if constexpr (!Profiling::enabled)
+        return;
+
+    auto& profiler = Profiling::CallProfiler::instance();
+    profiler.reset();
+
+    for (int i = 0; i < 100; ++i)
+        Profiling::call_wrapper<"test::multiply">(multiply, i, 2);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+        threads.emplace_back([] {
+            for (int i = 0; i < 1000; ++i)
+                Profiling::call_wrapper<"test::threads">(multiply, i, 3);
+        });
+
+    for (auto& thd : threads)
+        thd.join();
+
+    const auto report = profiler.report();
+
+    const auto* site_multiply = find_site(report, "test::multiply");
+    REQUIRE(site_multiply != nullptr);
+    CHECK(site_multiply->calls == 100);
+
+    const auto* site_threads = find_site(report, "test::threads");
+    REQUIRE(site_threads != nullptr);
+    CHECK(site_threads->calls == 4000);
+
+    std::ostringstream out;
+    profiler.dump(out);
+    CHECK_THAT(out.str(), Catch::Matchers::ContainsSubstring("test::multiply: 100 calls"));
+    CHECK_THAT(out.str(), Catch::Matchers::ContainsSubstring("test::threads: 4000 calls"));
+
+    profiler.reset();
+    CHECK(find_site(profiler.report(), "test::multiply")->calls == 0);
+    CHECK(find_site(profiler.report(), "test::threads")->calls == 0);
+}
+
+TEST_CASE("Profiling::CallProfiler - data of finished threads is released")
+{
+    if constexpr (!Profiling::enabled)
+        return;
+
+    auto& profiler = Profiling::CallProfiler::instance();
+    profiler.reset();
+    Profiling::call_wrapper<"test::short_lived">(multiply, 1, 1); // registers this thread
+
+    const size_t thread_count = profiler.thread_count();
+
+    for (int t = 0; t < 100; ++t)
+        std::thread{[] { Profiling::call_wrapper<"test::short_lived">(multiply, 2, 2); }}.join();
+
+    CHECK(profiler.thread_count() == thread_count);
+    CHECK(find_site(profiler.report(), "test::short_lived")->calls == 101);
+}
+
+TEST_CASE("Profiling::bucket_of")
+{
+    static_assert(Profiling::bucket_of(0) == 0);
+    static_assert(Profiling::bucket_of(1) == 0);
+    static_assert(Profiling::bucket_of(2) == 1);
+    static_assert(Profiling::bucket_of(1023) == 9);
+    static_assert(Profiling::bucket_of(1024) == 10);
+    static_assert(Profiling::bucket_of(~uint64_t{0}) == Profiling::bucket_count - 1);
+}
+
+TEST_CASE("Profiling::call_wrapper - overhead", "[.][benchmark]")
+{
+    int x = 1;
+
+    BENCHMARK("direct call")
+    {
+        return multiply(x, 2);
+    };
+
+    BENCHMARK("instrumented call")
+    {
+        return Profiling::call_wrapper<"benchmark::multiply">(multiply, x, 2);
+    };
+}
@@ -0,0 +1,93 @@
+// Compile-time benchmark for VT::TypeList
+//   -DTYPELIST_SIZE=N           - number of types in the generated pack
+//   -DTYPELIST_BENCH_RECURSIVE  - use head-tail recursive implementations as a baseline
+
+#include "typelist.hpp"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#ifndef TYPELIST_SIZE
+#define TYPELIST_SIZE 100
+#endif
+
+constexpr size_t N = TYPELIST_SIZE;
+
+template <size_t I>
+struct Field
+{ };
+
+template <typename IndexSeq>
+struct MakeFields;
+
+template <size_t... Is>
+struct MakeFields<std::index_sequence<Is...>>
+{
+    using type = VT::TypeList<Field<Is>..., Field<Is % 10>...>; // second half contains duplicates
+};
+
+using Fields = typename MakeFields<std::make_index_sequence<N>>::type;
+
+template <typename T>
+struct IsEven : std::false_type
+{ };
+
+template <size_t I>
+struct IsEven<Field<I>> : std::bool_constant<I % 2 == 0>
+{ };
+
+#ifndef TYPELIST_BENCH_RECURSIVE
+
+static_assert(VT::Size_v<Fields> == 2 * N);
+static_assert(std::is_same_v<VT::At_t<N - 1, Fields>, Field<N - 1>>);
+static_assert(VT::IndexOf_v<Field<N / 2>, Fields> == N / 2);
+static_assert(VT::Size_v<VT::Transform_t<std::add_pointer_t, Fields>> == 2 * N);
+static_assert(VT::Size_v<VT::Filter_t<IsEven, Fields>> == N / 2 + N / 2 + (N % 2));
+static_assert(VT::Size_v<VT::Unique_t<Fields>> == N);
+
+#else
+
+namespace Recursive
+{
+    template <typename TList>
+    struct Size;
+
+    template <>
+    struct Size<VT::TypeList<>> : std::integral_constant<size_t, 0>
+    { };
+
+    template <typename Head, typename... Tail>
+    struct Size<VT::TypeList<Head, Tail...>> : std::integral_constant<size_t, 1 + Size<VT::TypeList<Tail...>>::value>
+    { };
+
+    template <size_t I, typename TList>
+    struct At;
+
+    template <typename Head, typename... Tail>
+    struct At<0, VT::TypeList<Head, Tail...>>
+    {
+        using type = Head;
+    };
+
+    template <size_t I, typename Head, typename... Tail>
+    struct At<I, VT::TypeList<Head, Tail...>> : At<I - 1, VT::TypeList<Tail...>>
+    { };
+
+    template <typename T, typename TList>
+    struct IndexOf;
+
+    template <typename T, typename... Tail>
+    struct IndexOf<T, VT::TypeList<T, Tail...>> : std::integral_constant<size_t, 0>
+    { };
+
+    template <typename T, typename Head, typename... Tail>
+    struct IndexOf<T, VT::TypeList<Head, Tail...>> : std::integral_constant<size_t, 1 + IndexOf<T, VT::TypeList<Tail...>>::value>
+    { };
+} // namespace Recursive
+
+static_assert(Recursive::Size<Fields>::value == 2 * N);
+static_assert(std::is_same_v<typename Recursive::At<N - 1, Fields>::type, Field<N - 1>>);
+static_assert(Recursive::IndexOf<Field<N / 2>, Fields>::value == N / 2);
+
+#endif
@@ -0,0 +1,141 @@
+#ifndef VARIADIC_TEMPLATES_FAST_PRINT_HPP
+#define VARIADIC_TEMPLATES_FAST_PRINT_HPP
+
+#include <array>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/////////////////////////////////////////////////////////////////
+// Buffered variadic print
+//
+// All arguments are rendered into a stack buffer (std::to_chars for numbers)
+// and written with a single call. The heap is used only when the output
+// does not fit into the buffer or for types printable only with operator<<.
+// Floating point values are printed in the shortest round-trip form.
+
+namespace VT::Buffered
+{
+    template <typename T>
+    concept Streamable = requires(std::ostream& out, const T& value) {
+        out << value;
+    };
+
+    template <size_t Capacity = 512>
+    class FormatBuffer
+    {
+        std::array<char, Capacity> buffer_;
+        size_t size_ = 0;
+        std::string overflow_; // used after the stack buffer is exhausted
+
+    public:
+        void append(std::string_view text)
+        {
+            if (overflow_.empty() && size_ + text.size() <= Capacity)
+            {
+                text.copy(buffer_.data() + size_, text.size());
+                size_ += text.size();
+            }
+            else
+            {
+                if (overflow_.empty())
+                    overflow_.assign(buffer_.data(), size_);
+                overflow_.append(text);
+            }
+        }
+
+        void append(char c)
+        {
+            append(std::string_view{&c, 1});
+        }
+
+        template <std::integral T>
+        void append_number(T value, int base = 10)
+        {
+            std::array<char, 72> digits; // enough for 64-bit values in base 2
+            auto [end, ec] = std::to_chars(digits.data(), digits.data() + digits.size(), value, base);
+            append(std::string_view(digits.data(), end - digits.data()));
+        }
+
+        template <std::floating_point T>
+        void append_number(T value)
+        {
+            std::array<char, 64> digits; // shortest round-trip form always fits
+            auto [end, ec] = std::to_chars(digits.data(), digits.data() + digits.size(), value);
+            append(std::string_view(digits.data(), end - digits.data()));
+        }
+
+        std::string_view view() const
+        {
+            return overflow_.empty() ? std::string_view{buffer_.data(), size_} : std::string_view{overflow_};
+        }
+    };
+
+    template <size_t Capacity, typename T>
+    void format_arg(FormatBuffer<Capacity>& buffer, const T& value)
+    {
+        if constexpr (std::is_same_v<T, bool>)
+            buffer.append(value ? '1' : '0'); // the same as std::ostream without std::boolalpha
+        else if constexpr (std::is_same_v<T, char> || std::is_same_v<T, signed char> || std::is_same_v<T, unsigned char>)
+            buffer.append(static_cast<char>(value));
+        else if constexpr (std::integral<T> || std::floating_point<T>)
+            buffer.append_number(value);
+        else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+            buffer.append(std::string_view{value});
+        else if constexpr (std::is_pointer_v<T>)
+        {
+            buffer.append("0x");
+            buffer.append_number(reinterpret_cast<std::uintptr_t>(value), 16);
+        }
+        else
+        {
+            static_assert(Streamable<T>, "Argument cannot be printed");
+
+            std::ostringstream out;
+            out << value;
+            buffer.append(std::move(out).str());
+        }
+    }
+
+    // renders "arg1 arg2 ... argN\n"
+    template <size_t Capacity, typename... Args>
+    std::string_view format_to(FormatBuffer<Capacity>& buffer, const Args&... args)
+    {
+        size_t index = 0;
+        (..., (index++ > 0 ? buffer.append(' ') : void(), format_arg(buffer, args)));
+        buffer.append('\n');
+
+        return buffer.view();
+    }
+
+    template <typename... Args>
+    void print_to(std::FILE* file, const Args&... args)
+    {
+        FormatBuffer buffer;
+        auto text = format_to(buffer, args...);
+        std::fwrite(text.data(), 1, text.size(), file);
+    }
+
+    template <typename... Args>
+    void print_to(std::ostream& out, const Args&... args)
+    {
+        FormatBuffer buffer;
+        auto text = format_to(buffer, args...);
+        out.write(text.data(), static_cast<std::streamsize>(text.size()));
+    }
+
+    template <typename... Args>
+    void print(const Args&... args)
+    {
+        print_to(stdout, args...);
+    }
+} // namespace VT::Buffered
+
+#endif // VARIADIC_TEMPLATES_FAST_PRINT_HPP
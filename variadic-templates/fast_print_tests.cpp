@@ -0,0 +1,87 @@
+#include "fast_print.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace std::literals;
+
+namespace
+{
+    struct Point
+    {
+        int x, y;
+
+        friend std::ostream& operator<<(std::ostream& out, const Point& pt)
+        {
+            return out << "Point(" << pt.x << ", " << pt.y << ")";
+        }
+    };
+
+    template <typename... Args>
+    std::string format(const Args&... args)
+    {
+        VT::Buffered::FormatBuffer buffer;
+        return std::string{VT::Buffered::format_to(buffer, args...)};
+    }
+
+    template <typename... Args>
+    void ostream_print(std::ostream& out, const Args&... args)
+    {
+        (..., (out << args << " ")) << "\n";
+    }
+} // namespace
+
+TEST_CASE("Buffered print - formatting")
+{
+    CHECK(format(1, 3.14, "text"s) == "1 3.14 text\n");
+    CHECK(format("ctext", 66.5, 42, 'c', true) == "ctext 66.5 42 c 1\n");
+    CHECK(format(-42L, 42u, 1e20, -0.5f) == "-42 42 1e+20 -0.5\n");
+    CHECK(format("view"sv) == "view\n");
+    CHECK(format() == "\n");
+}
+
+TEST_CASE("Buffered print - types printable only with operator<<")
+{
+    CHECK(format(Point{1, 2}, 3) == "Point(1, 2) 3\n");
+}
+
+TEST_CASE("Buffered print - output longer than the stack buffer")
+{
+    const std::string long_text(1000, 'x');
+
+    CHECK(format(1, long_text, 2) == "1 " + long_text + " 2\n");
+}
+
+TEST_CASE("Buffered print - single write to stream")
+{
+    std::ostringstream out;
+    VT::Buffered::print_to(out, 1, 42, 3.14, "text");
+
+    CHECK(out.str() == "1 42 3.14 text\n");
+}
+
+TEST_CASE("Buffered print vs. ostream fold", "[.][benchmark]")
+{
+    std::ofstream null_stream{"/dev/null"};
+    std::FILE* null_file = std::fopen("/dev/null", "w");
+    REQUIRE(null_file != nullptr);
+
+    const std::string user = "admin";
+
+    BENCHMARK("ostream fold")
+    {
+        ostream_print(null_stream, "request", 42, "user", user, "latency", 3.14159, "status", 200);
+    };
+
+    BENCHMARK("Buffered::print_to")
+    {
+        VT::Buffered::print_to(null_file, "request", 42, "user", user, "latency", 3.14159, "status", 200);
+    };
+
+    std::fclose(null_file);
+}
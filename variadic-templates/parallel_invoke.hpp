@@ -0,0 +1,94 @@
+#ifndef VARIADIC_TEMPLATES_PARALLEL_INVOKE_HPP
+#define VARIADIC_TEMPLATES_PARALLEL_INVOKE_HPP
+
+#include "thread_pool.hpp"
+
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <latch>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace VT::Folds
+{
+    /////////////////////////////////////////////////////////////////
+    // parallel_invoke - runs each callable of a pack as a separate task
+    //
+    // The last callable runs on the calling thread, so a pack of one never touches
+    // the pool. While waiting, the caller executes queued tasks (nested calls
+    // from pool threads cannot deadlock). All callables run; the first exception
+    // thrown is rethrown after they finish.
+
+    template <typename... Fs>
+    void parallel_invoke(ThreadPool& pool, Fs&&... fs)
+    {
+        constexpr size_t task_count = sizeof...(Fs);
+
+        if constexpr (task_count < 2)
+        {
+            (..., std::invoke(std::forward<Fs>(fs)));
+        }
+        else
+        {
+            struct Context
+            {
+                std::tuple<Fs&...> tasks;
+                std::array<std::exception_ptr, task_count> errors{};
+                std::latch done{task_count - 1};
+            } ctx{std::tie(fs...)};
+
+            [&]<size_t... Is>(std::index_sequence<Is...>) {
+                (..., pool.submit([context = &ctx] {
+                    try
+                    {
+                        std::invoke(std::get<Is>(context->tasks));
+                    }
+                    catch (...)
+                    {
+                        context->errors[Is] = std::current_exception();
+                    }
+                    context->done.count_down();
+                }));
+            }(std::make_index_sequence<task_count - 1>{});
+
+            try
+            {
+                std::invoke(std::get<task_count - 1>(ctx.tasks));
+            }
+            catch (...)
+            {
+                ctx.errors[task_count - 1] = std::current_exception();
+            }
+
+            while (!ctx.done.try_wait())
+            {
+                if (!pool.run_pending_task())
+                    std::this_thread::yield();
+            }
+
+            for (const auto& error : ctx.errors)
+                if (error)
+                    std::rethrow_exception(error);
+        }
+    }
+
+    template <typename... Fs>
+        requires (... && std::is_invocable_v<Fs&>)
+    void parallel_invoke(Fs&&... fs)
+    {
+        parallel_invoke(default_thread_pool(), std::forward<Fs>(fs)...);
+    }
+
+    // parallel counterpart of call_foreach - f(arg) for each argument as a separate task
+    template <typename F, typename... Args>
+    void parallel_foreach(F&& f, Args&&... args)
+    {
+        parallel_invoke([&f, &args] { f(std::forward<Args>(args)); }...);
+    }
+} // namespace VT::Folds
+
+#endif // VARIADIC_TEMPLATES_PARALLEL_INVOKE_HPP
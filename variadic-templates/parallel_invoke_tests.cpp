@@ -0,0 +1,170 @@
+#include "parallel_invoke.hpp"
+
+#include <atomic>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::literals;
+
+TEST_CASE("parallel_invoke")
+{
+    SECTION("all tasks are executed")
+    {
+        int a = 0, b = 0, c = 0;
+
+        VT::Folds::parallel_invoke([&] { a = 1; }, [&] { b = 2; }, [&] { c = 3; });
+
+        CHECK(a + b + c == 6);
+    }
+
+    SECTION("single task runs inline on the calling thread")
+    {
+        std::thread::id id;
+
+        VT::Folds::parallel_invoke([&] { id = std::this_thread::get_id(); });
+
+        CHECK(id == std::this_thread::get_id());
+    }
+
+    SECTION("two tasks run on two threads")
+    {
+        ThreadPool pool{2};
+        std::thread::id first, second;
+
+        auto slow = [](std::thread::id& id) {
+            std::this_thread::sleep_for(10ms);
+            id = std::this_thread::get_id();
+        };
+
+        VT::Folds::parallel_invoke(pool, [&] { slow(first); }, [&] { slow(second); });
+
+        CHECK(second == std::this_thread::get_id());
+        CHECK(first != second);
+    }
+
+    SECTION("tasks run on pool threads")
+    {
+        ThreadPool pool{4};
+        std::mutex mtx;
+        std::set<std::thread::id> ids;
+
+        auto task = [&] {
+            std::this_thread::sleep_for(10ms);
+            std::lock_guard lk{mtx};
+            ids.insert(std::this_thread::get_id());
+        };
+
+        VT::Folds::parallel_invoke(pool, task, task, task, task);
+
+        CHECK(ids.size() > 1);
+    }
+
+    SECTION("exception is propagated after all tasks complete")
+    {
+        std::atomic<int> counter = 0;
+
+        auto ok = [&] { ++counter; };
+        auto failing = [] { throw std::runtime_error("error"); };
+
+        CHECK_THROWS_AS(VT::Folds::parallel_invoke(ok, failing, ok, ok), std::runtime_error);
+        CHECK(counter == 3);
+
+        CHECK_THROWS_AS(VT::Folds::parallel_invoke(failing, ok), std::runtime_error);
+        CHECK(counter == 4);
+    }
+
+    SECTION("nested calls from pool threads do not deadlock")
+    {
+        ThreadPool pool{1};
+        std::atomic<int> counter = 0;
+
+        auto inner = [&] { ++counter; };
+        auto outer = [&] { VT::Folds::parallel_invoke(pool, inner, inner); };
+
+        VT::Folds::parallel_invoke(pool, outer, outer, outer);
+
+        CHECK(counter == 6);
+    }
+}
+
+TEST_CASE("parallel_foreach")
+{
+    std::vector<int> results(4);
+
+    auto square = [&](int x) { results[x] = x * x; };
+
+    VT::Folds::parallel_foreach(square, 0, 1, 2, 3);
+
+    CHECK(results == std::vector{0, 1, 4, 9});
+
+    std::vector<std::string> words;
+    VT::Folds::parallel_foreach([&](std::string&& w) { words.push_back(std::move(w)); }, "text"s);
+    CHECK(words == std::vector{"text"s});
+}
+
+namespace
+{
+    template <size_t... Is>
+    void run_sequential(std::index_sequence<Is...>, auto& task)
+    {
+        (..., ((void)Is, task()));
+    }
+
+    template <size_t... Is>
+    void run_parallel(std::index_sequence<Is...>, auto& task)
+    {
+        VT::Folds::parallel_invoke(((void)Is, task)...);
+    }
+
+    template <size_t N>
+    void benchmark_tasks(auto& task)
+    {
+        BENCHMARK("sequential - " + std::to_string(N) + " tasks")
+        {
+            run_sequential(std::make_index_sequence<N>{}, task);
+        };
+
+        BENCHMARK("parallel_invoke - " + std::to_string(N) + " tasks")
+        {
+            run_parallel(std::make_index_sequence<N>{}, task);
+        };
+    }
+} // namespace
+
+TEST_CASE("parallel_invoke - latency", "[.][benchmark]")
+{
+    std::vector<double> data(1'000'000, 1.0);
+
+    auto expensive = [&data] {
+        volatile double sum = std::accumulate(data.begin(), data.end(), 0.0);
+        (void)sum;
+    };
+
+    auto trivial = [] {
+        volatile int x = 42;
+        (void)x;
+    };
+
+    SECTION("expensive tasks")
+    {
+        benchmark_tasks<2>(expensive);
+        benchmark_tasks<4>(expensive);
+        benchmark_tasks<8>(expensive);
+        benchmark_tasks<16>(expensive);
+    }
+
+    SECTION("trivial tasks")
+    {
+        benchmark_tasks<1>(trivial);
+        benchmark_tasks<2>(trivial);
+        benchmark_tasks<3>(trivial);
+        benchmark_tasks<4>(trivial);
+        benchmark_tasks<16>(trivial);
+    }
+}
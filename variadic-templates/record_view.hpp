@@ -0,0 +1,360 @@
+#ifndef VARIADIC_TEMPLATES_RECORD_VIEW_HPP
+#define VARIADIC_TEMPLATES_RECORD_VIEW_HPP
+
+#include "table.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <string>
+#include <system_error>
+#endif
+
+/////////////////////////////////////////////////////////////////
+// Pointers - zero-copy view of a single record
+//
+// Fields may live in separate columns or inside one fixed-width record -
+// a view only points at them, nothing is copied or deserialized.
+
+template <typename... Types>
+struct Pointers
+{
+    std::tuple<const Types*...> ptrs;
+
+    template <size_t I>
+    const auto& get() const
+    {
+        return *std::get<I>(ptrs);
+    }
+};
+
+template <size_t I, typename... Types>
+const auto& get(const Pointers<Types...>& record)
+{
+    return record.template get<I>();
+}
+
+/////////////////////////////////////////////////////////////////
+// RecordLayout - offsets of fields in a fixed-width record
+//
+// Fields are laid out like members of a struct: each one is aligned to its
+// natural alignment and the record size is rounded up to the largest alignment.
+
+template <typename... Types>
+struct RecordLayout
+{
+    static_assert((... && std::is_trivially_copyable_v<Types>), "Fields of a record must be trivially copyable");
+
+    static constexpr size_t alignment = std::max({alignof(Types)...});
+
+    static constexpr std::array<size_t, sizeof...(Types)> offsets = [] {
+        constexpr size_t sizes[] = {sizeof(Types)...};
+        constexpr size_t alignments[] = {alignof(Types)...};
+
+        std::array<size_t, sizeof...(Types)> result{};
+        size_t offset = 0;
+        for (size_t i = 0; i < result.size(); ++i)
+        {
+            offset = (offset + alignments[i] - 1) / alignments[i] * alignments[i];
+            result[i] = offset;
+            offset += sizes[i];
+        }
+        return result;
+    }();
+
+    static constexpr size_t size = [] {
+        constexpr size_t sizes[] = {sizeof(Types)...};
+        size_t end = offsets.back() + sizes[sizeof...(Types) - 1];
+        return (end + alignment - 1) / alignment * alignment;
+    }();
+
+    static Pointers<Types...> view(const std::byte* record)
+    {
+        return view(record, std::index_sequence_for<Types...>{});
+    }
+
+private:
+    template <size_t... Is>
+    static Pointers<Types...> view(const std::byte* record, std::index_sequence<Is...>)
+    {
+        return {{reinterpret_cast<const Types*>(record + offsets[Is])...}};
+    }
+};
+
+/////////////////////////////////////////////////////////////////
+// RecordRange - range of record views with a byte stride per field
+//
+// Iterators hold copies of the base pointers & strides - they stay valid
+// when the range object is gone (only the viewed data must live on).
+
+template <typename... Types>
+class RecordRange
+{
+    Pointers<Types...> first_;
+    std::array<std::ptrdiff_t, sizeof...(Types)> strides_;
+    size_t size_;
+
+public:
+    class iterator
+    {
+        Pointers<Types...> first_{};
+        std::array<std::ptrdiff_t, sizeof...(Types)> strides_{};
+        std::ptrdiff_t index_{};
+
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Pointers<Types...>;
+        using difference_type = std::ptrdiff_t;
+        using reference = Pointers<Types...>;
+
+        iterator() = default;
+
+        iterator(const RecordRange& range, std::ptrdiff_t index)
+            : first_{range.first_}
+            , strides_{range.strides_}
+            , index_{index}
+        { }
+
+        reference operator*() const
+        {
+            return RecordRange::at(first_, strides_, index_, std::index_sequence_for<Types...>{});
+        }
+
+        reference operator[](difference_type n) const
+        {
+            return *(*this + n);
+        }
+
+        iterator& operator++()
+        {
+            ++index_;
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            iterator temp{*this};
+            ++index_;
+            return temp;
+        }
+
+        iterator& operator--()
+        {
+            --index_;
+            return *this;
+        }
+
+        iterator operator--(int)
+        {
+            iterator temp{*this};
+            --index_;
+            return temp;
+        }
+
+        iterator& operator+=(difference_type n)
+        {
+            index_ += n;
+            return *this;
+        }
+
+        iterator& operator-=(difference_type n)
+        {
+            index_ -= n;
+            return *this;
+        }
+
+        friend iterator operator+(iterator it, difference_type n)
+        {
+            return it += n;
+        }
+
+        friend iterator operator+(difference_type n, iterator it)
+        {
+            return it += n;
+        }
+
+        friend iterator operator-(iterator it, difference_type n)
+        {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const iterator& a, const iterator& b)
+        {
+            return a.index_ - b.index_;
+        }
+
+        bool operator==(const iterator& other) const
+        {
+            return index_ == other.index_;
+        }
+
+        auto operator<=>(const iterator& other) const
+        {
+            return index_ <=> other.index_;
+        }
+    };
+
+    RecordRange(Pointers<Types...> first, std::array<std::ptrdiff_t, sizeof...(Types)> strides, size_t size)
+        : first_{first}
+        , strides_{strides}
+        , size_{size}
+    { }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    Pointers<Types...> operator[](size_t index) const
+    {
+        assert(index < size_);
+        return at(first_, strides_, static_cast<std::ptrdiff_t>(index), std::index_sequence_for<Types...>{});
+    }
+
+    iterator begin() const
+    {
+        return iterator{*this, 0};
+    }
+
+    iterator end() const
+    {
+        return iterator{*this, static_cast<std::ptrdiff_t>(size_)};
+    }
+
+private:
+    template <size_t... Is>
+    static Pointers<Types...> at(const Pointers<Types...>& first, const std::array<std::ptrdiff_t, sizeof...(Types)>& strides,
+        std::ptrdiff_t index, std::index_sequence<Is...>)
+    {
+        return {{reinterpret_cast<const Types*>(
+            reinterpret_cast<const std::byte*>(std::get<Is>(first.ptrs)) + index * strides[Is])...}};
+    }
+};
+
+// view of fixed-width records stored one after another (e.g. in a memory-mapped file)
+template <typename... Types>
+RecordRange<Types...> records_view(std::span<const std::byte> buffer)
+{
+    using Layout = RecordLayout<Types...>;
+
+    assert(reinterpret_cast<std::uintptr_t>(buffer.data()) % Layout::alignment == 0);
+
+    std::array<std::ptrdiff_t, sizeof...(Types)> strides;
+    strides.fill(static_cast<std::ptrdiff_t>(Layout::size));
+
+    return {Layout::view(buffer.data()), strides, buffer.size() / Layout::size};
+}
+
+// view of rows stored in columns of a Table
+template <typename... Types>
+RecordRange<Types...> records_view(const Table<Types...>& table)
+{
+    return [&]<size_t... Is>(std::index_sequence<Is...>) -> RecordRange<Types...> {
+        return {Pointers<Types...>{{table.template column<Is>().data()...}},
+            {static_cast<std::ptrdiff_t>(sizeof(Types))...}, table.size()};
+    }(std::index_sequence_for<Types...>{});
+}
+
+#if __has_include(<sys/mman.h>)
+
+/////////////////////////////////////////////////////////////////
+// MappedFile - read-only memory mapping of a file (POSIX)
+
+class MappedFile
+{
+    void* data_ = nullptr;
+    size_t size_ = 0;
+
+public:
+    explicit MappedFile(const std::string& path)
+    {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+            throw std::system_error(errno, std::generic_category(), "Cannot open file " + path);
+
+        struct stat file_stat{};
+        if (::fstat(fd, &file_stat) == -1)
+        {
+            int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "Cannot stat file " + path);
+        }
+
+        size_ = static_cast<size_t>(file_stat.st_size);
+
+        if (size_ > 0)
+        {
+            data_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data_ == MAP_FAILED)
+            {
+                int error = errno;
+                ::close(fd);
+                throw std::system_error(error, std::generic_category(), "Cannot map file " + path);
+            }
+        }
+
+        ::close(fd);
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept
+        : data_{std::exchange(other.data_, nullptr)}
+        , size_{std::exchange(other.size_, 0)}
+    { }
+
+    MappedFile& operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            unmap();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    ~MappedFile()
+    {
+        unmap();
+    }
+
+    std::span<const std::byte> bytes() const
+    {
+        return {static_cast<const std::byte*>(data_), size_};
+    }
+
+private:
+    void unmap()
+    {
+        if (data_)
+            ::munmap(data_, size_);
+    }
+};
+
+#endif
+
+#endif // VARIADIC_TEMPLATES_RECORD_VIEW_HPP
@@ -0,0 +1,135 @@
+#include "record_view.hpp"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct Trade
+    {
+        int64_t id;
+        double price;
+        int32_t quantity;
+    };
+
+    using TradeLayout = RecordLayout<int64_t, double, int32_t>;
+
+    static_assert(TradeLayout::offsets[0] == offsetof(Trade, id));
+    static_assert(TradeLayout::offsets[1] == offsetof(Trade, price));
+    static_assert(TradeLayout::offsets[2] == offsetof(Trade, quantity));
+    static_assert(TradeLayout::size == sizeof(Trade));
+
+    static_assert(std::random_access_iterator<RecordRange<int64_t, double, int32_t>::iterator>);
+} // namespace
+
+TEST_CASE("Pointers - view of a single record")
+{
+    int x = 42;
+    double y = 3.14;
+
+    Pointers<int, double> record{{&x, &y}};
+
+    CHECK(record.get<0>() == 42);
+    CHECK(get<1>(record) == 3.14);
+
+    x = 665;
+    CHECK(record.get<0>() == 665);
+}
+
+TEST_CASE("RecordRange - view of a columnar table")
+{
+    Table<int, double> table;
+    table.push_back(1, 1.5);
+    table.push_back(2, 2.5);
+    table.push_back(3, 3.5);
+
+    auto records = records_view(table);
+
+    REQUIRE(records.size() == 3);
+    CHECK(records[1].get<0>() == 2);
+    CHECK(&records[2].get<1>() == &table.column<1>()[2]);
+
+    double total = 0.0;
+    for (auto record : records)
+        total += record.get<0>() * record.get<1>();
+
+    CHECK(total == 1 * 1.5 + 2 * 2.5 + 3 * 3.5);
+
+    SECTION("iterators outlive the range object")
+    {
+        auto it = records_view(table).begin();
+        auto last = records_view(table).end();
+
+        CHECK((*it).get<0>() == 1);
+        CHECK(it[2].get<1>() == 3.5);
+        CHECK(last - it == 3);
+    }
+}
+
+#if __has_include(<sys/mman.h>)
+
+TEST_CASE("RecordRange - view of a memory-mapped file")
+{
+    // unique per process - test runs may overlap
+    const auto path = std::filesystem::temp_directory_path() / ("record_view_tests_" + std::to_string(::getpid()) + ".bin");
+
+    std::vector<Trade> trades;
+    for (int i = 0; i < 1000; ++i)
+        trades.push_back(Trade{i, i * 0.5, i % 7});
+
+    {
+        std::ofstream out{path, std::ios::binary};
+        out.write(reinterpret_cast<const char*>(trades.data()), trades.size() * sizeof(Trade));
+    }
+
+    {
+        MappedFile file{path.string()};
+        auto records = records_view<int64_t, double, int32_t>(file.bytes());
+
+        REQUIRE(records.size() == trades.size());
+
+        SECTION("fields are read in place")
+        {
+            CHECK(records[0].get<0>() == 0);
+            CHECK(records[999].get<0>() == 999);
+            CHECK(records[10].get<1>() == 5.0);
+            CHECK(records[10].get<2>() == 3);
+
+            CHECK(reinterpret_cast<const std::byte*>(&records[1].get<0>()) == file.bytes().data() + sizeof(Trade));
+        }
+
+        SECTION("strided iteration over records")
+        {
+            int64_t quantity = 0;
+            for (auto record : records)
+                quantity += record.get<2>();
+
+            CHECK(quantity == std::accumulate(trades.begin(), trades.end(), int64_t{0},
+                                  [](int64_t total, const Trade& t) { return total + t.quantity; }));
+        }
+
+        SECTION("works with standard algorithms")
+        {
+            auto it = std::ranges::find_if(records, [](auto record) { return record.template get<1>() == 100.0; });
+
+            REQUIRE(it != records.end());
+            CHECK((*it).get<0>() == 200);
+            CHECK(it - records.begin() == 200);
+        }
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("MappedFile - missing file")
+{
+    CHECK_THROWS_AS(MappedFile{"/non/existing/file.bin"}, std::system_error);
+}
+
+#endif
@@ -0,0 +1,172 @@
+#ifndef VARIADIC_TEMPLATES_STATIC_VECTOR_HPP
+#define VARIADIC_TEMPLATES_STATIC_VECTOR_HPP
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/////////////////////////////////////////////////////////////////
+// StaticVector - vector with fixed capacity and inline storage
+//
+// Elements are constructed in place in an uninitialized buffer -
+// no heap allocation is ever made.
+
+template <typename T, size_t N>
+class StaticVector
+{
+    alignas(T) std::array<std::byte, sizeof(T) * N> storage_;
+    size_t size_ = 0;
+
+public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using size_type = size_t;
+
+    StaticVector() = default;
+
+    StaticVector(const StaticVector& other)
+    {
+        std::uninitialized_copy(other.begin(), other.end(), data());
+        size_ = other.size_;
+    }
+
+    StaticVector(StaticVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        std::uninitialized_move(other.begin(), other.end(), data());
+        size_ = other.size_;
+    }
+
+    StaticVector& operator=(const StaticVector& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            std::uninitialized_copy(other.begin(), other.end(), data());
+            size_ = other.size_;
+        }
+        return *this;
+    }
+
+    StaticVector& operator=(StaticVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this != &other)
+        {
+            clear();
+            std::uninitialized_move(other.begin(), other.end(), data());
+            size_ = other.size_;
+        }
+        return *this;
+    }
+
+    ~StaticVector()
+    {
+        clear();
+    }
+
+    static constexpr size_t capacity()
+    {
+        return N;
+    }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        assert(size_ < N);
+
+        T* item = std::construct_at(data() + size_, std::forward<Args>(args)...);
+        ++size_;
+
+        return *item;
+    }
+
+    void push_back(const T& item)
+    {
+        emplace_back(item);
+    }
+
+    void push_back(T&& item)
+    {
+        emplace_back(std::move(item));
+    }
+
+    void pop_back()
+    {
+        assert(size_ > 0);
+        std::destroy_at(data() + --size_);
+    }
+
+    void clear()
+    {
+        std::destroy(begin(), end());
+        size_ = 0;
+    }
+
+    T& operator[](size_t index)
+    {
+        assert(index < size_);
+        return data()[index];
+    }
+
+    const T& operator[](size_t index) const
+    {
+        assert(index < size_);
+        return data()[index];
+    }
+
+    T* data()
+    {
+        return std::launder(reinterpret_cast<T*>(storage_.data()));
+    }
+
+    const T* data() const
+    {
+        return std::launder(reinterpret_cast<const T*>(storage_.data()));
+    }
+
+    iterator begin()
+    {
+        return data();
+    }
+
+    iterator end()
+    {
+        return data() + size_;
+    }
+
+    const_iterator begin() const
+    {
+        return data();
+    }
+
+    const_iterator end() const
+    {
+        return data() + size_;
+    }
+
+    bool operator==(const StaticVector& other) const
+    {
+        return std::equal(begin(), end(), other.begin(), other.end());
+    }
+};
+
+#endif // VARIADIC_TEMPLATES_STATIC_VECTOR_HPP
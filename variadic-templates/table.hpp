@@ -0,0 +1,229 @@
+#ifndef VARIADIC_TEMPLATES_TABLE_HPP
+#define VARIADIC_TEMPLATES_TABLE_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+template <typename... Types>
+struct Row
+{
+    std::tuple<Types...> data;
+};
+
+/////////////////////////////////////////////////////////////////
+// Table - columnar (struct-of-arrays) storage of rows
+//
+// Each column is kept in its own contiguous vector, so a scan of one column
+// reads only bytes of that column. bool columns are not supported -
+// std::vector<bool> is not contiguous; use char or unsigned char instead.
+
+template <typename... Types>
+class Table
+{
+    static_assert(sizeof...(Types) > 0, "Table requires at least one column");
+    static_assert((... && !std::is_same_v<std::remove_cv_t<Types>, bool>), "bool columns are not supported - use char");
+
+    std::tuple<std::vector<Types>...> columns_;
+
+    template <typename TTable>
+    class BasicRowRef
+    {
+        TTable* table_;
+        size_t index_;
+
+    public:
+        BasicRowRef(TTable& table, size_t index)
+            : table_{&table}
+            , index_{index}
+        { }
+
+        template <size_t I>
+        decltype(auto) get() const
+        {
+            return std::get<I>(table_->columns_)[index_];
+        }
+
+        size_t index() const
+        {
+            return index_;
+        }
+
+        Row<Types...> to_row() const
+        {
+            return to_row(std::index_sequence_for<Types...>{});
+        }
+
+        operator Row<Types...>() const
+        {
+            return to_row();
+        }
+
+    private:
+        template <size_t... Is>
+        Row<Types...> to_row(std::index_sequence<Is...>) const
+        {
+            return Row<Types...>{std::tuple<Types...>{get<Is>()...}};
+        }
+    };
+
+    template <typename TTable>
+    class BasicIterator
+    {
+        TTable* table_{};
+        size_t index_{};
+
+    public:
+        using iterator_concept = std::forward_iterator_tag;
+        using value_type = Row<Types...>;
+        using difference_type = std::ptrdiff_t;
+        using reference = BasicRowRef<TTable>;
+
+        BasicIterator() = default;
+
+        BasicIterator(TTable& table, size_t index)
+            : table_{&table}
+            , index_{index}
+        { }
+
+        reference operator*() const
+        {
+            return reference{*table_, index_};
+        }
+
+        BasicIterator& operator++()
+        {
+            ++index_;
+            return *this;
+        }
+
+        BasicIterator operator++(int)
+        {
+            BasicIterator temp{*this};
+            ++index_;
+            return temp;
+        }
+
+        bool operator==(const BasicIterator& other) const
+        {
+            assert(table_ == other.table_);
+            return index_ == other.index_;
+        }
+    };
+
+public:
+    using row_type = Row<Types...>;
+    using row_reference = BasicRowRef<Table>;
+    using const_row_reference = BasicRowRef<const Table>;
+    using iterator = BasicIterator<Table>;
+    using const_iterator = BasicIterator<const Table>;
+
+    template <size_t I>
+    using column_type = std::tuple_element_t<I, std::tuple<Types...>>;
+
+    Table() = default;
+
+    size_t size() const
+    {
+        return std::get<0>(columns_).size();
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    void reserve(size_t capacity)
+    {
+        std::apply([capacity](auto&... columns) { (..., columns.reserve(capacity)); }, columns_);
+    }
+
+    template <typename... Args>
+        requires(sizeof...(Args) == sizeof...(Types))
+    void push_back(Args&&... args)
+    {
+        push_back_impl(std::index_sequence_for<Types...>{}, std::forward<Args>(args)...);
+    }
+
+    void push_back(const row_type& row)
+    {
+        std::apply([this](const auto&... fields) { push_back(fields...); }, row.data);
+    }
+
+    row_reference operator[](size_t index)
+    {
+        return row_reference{*this, index};
+    }
+
+    const_row_reference operator[](size_t index) const
+    {
+        return const_row_reference{*this, index};
+    }
+
+    template <size_t I>
+    std::span<column_type<I>> column()
+    {
+        return std::get<I>(columns_);
+    }
+
+    template <size_t I>
+    std::span<const column_type<I>> column() const
+    {
+        return std::get<I>(columns_);
+    }
+
+    // calls f(col<Is>[0]...), f(col<Is>[1]...), ... - only selected columns are read
+    template <size_t... Is, typename F>
+    void scan(F&& f) const
+    {
+        const auto columns = std::tuple{column<Is>()...};
+        const size_t count = size();
+
+        for (size_t i = 0; i < count; ++i)
+            std::apply([&](const auto&... col) { f(col[i]...); }, columns);
+    }
+
+    iterator begin()
+    {
+        return iterator{*this, 0};
+    }
+
+    iterator end()
+    {
+        return iterator{*this, size()};
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator{*this, 0};
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator{*this, size()};
+    }
+
+private:
+    // if a push throws, columns already pushed are shortened back - all columns keep the same size
+    template <size_t... Is, typename... Args>
+    void push_back_impl(std::index_sequence<Is...>, Args&&... args)
+    {
+        size_t pushed = 0;
+        try
+        {
+            (..., (std::get<Is>(columns_).push_back(std::forward<Args>(args)), ++pushed));
+        }
+        catch (...)
+        {
+            (..., (Is < pushed ? std::get<Is>(columns_).pop_back() : void()));
+            throw;
+        }
+    }
+};
+
+#endif // VARIADIC_TEMPLATES_TABLE_HPP
@@ -0,0 +1,129 @@
+#include "table.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std::literals;
+
+TEST_CASE("Table - columnar storage")
+{
+    Table<int, double, std::string> table;
+    table.push_back(1, 1.5, "one");
+    table.push_back(2, 2.5, "two"s);
+    table.push_back(Row<int, double, std::string>{{3, 3.5, "three"}});
+
+    REQUIRE(table.size() == 3);
+
+    SECTION("each column is contiguous")
+    {
+        auto ids = table.column<0>();
+        CHECK(ids.size() == 3);
+        CHECK(&ids[1] == &ids[0] + 1);
+        CHECK(std::accumulate(ids.begin(), ids.end(), 0) == 6);
+    }
+
+    SECTION("row proxy gives access to fields")
+    {
+        auto row = table[1];
+        CHECK(row.get<0>() == 2);
+        CHECK(row.get<2>() == "two"s);
+
+        row.get<1>() = 42.0;
+        CHECK(table.column<1>()[1] == 42.0);
+    }
+
+    SECTION("row proxy converts to Row")
+    {
+        Row<int, double, std::string> row = table[2];
+        CHECK(row.data == std::tuple{3, 3.5, "three"s});
+    }
+
+    SECTION("iteration over rows")
+    {
+        std::vector<std::string> names;
+        for (auto row : table)
+            names.push_back(row.get<2>());
+
+        CHECK(names == std::vector{"one"s, "two"s, "three"s});
+
+        for (auto row : table)
+            row.get<0>() *= 10;
+
+        CHECK(table[2].get<0>() == 30);
+    }
+
+    SECTION("scan of selected columns")
+    {
+        double total = 0.0;
+        table.scan<0, 1>([&](int id, double value) { total += id * value; });
+
+        CHECK(total == 1 * 1.5 + 2 * 2.5 + 3 * 3.5);
+    }
+}
+
+namespace
+{
+    struct ThrowingCopy
+    {
+        bool fail = false;
+
+        ThrowingCopy() = default;
+
+        ThrowingCopy(const ThrowingCopy& other)
+        {
+            if (other.fail)
+                throw std::runtime_error("copy failed");
+        }
+    };
+} // namespace
+
+TEST_CASE("Table - failed push_back leaves columns of equal size")
+{
+    Table<int, std::string, ThrowingCopy> table;
+    table.push_back(1, "one", ThrowingCopy{});
+
+    ThrowingCopy failing;
+    failing.fail = true;
+    CHECK_THROWS_AS(table.push_back(2, "two", failing), std::runtime_error);
+
+    CHECK(table.size() == 1);
+    CHECK(table.column<0>().size() == 1);
+    CHECK(table.column<1>().size() == 1);
+    CHECK(table.column<2>().size() == 1);
+}
+
+TEST_CASE("Table - column sum AoS vs. SoA", "[.][benchmark]")
+{
+    constexpr size_t row_count = 10'000'000;
+
+    using Record = Row<int64_t, double, double, char[16]>;
+
+    std::vector<Record> aos(row_count);
+    Table<int64_t, double, double, std::array<char, 16>> soa;
+    soa.reserve(row_count);
+
+    for (size_t i = 0; i < row_count; ++i)
+    {
+        std::get<1>(aos[i].data) = static_cast<double>(i % 100);
+        soa.push_back(static_cast<int64_t>(i), static_cast<double>(i % 100), 0.0, std::array<char, 16>{});
+    }
+
+    BENCHMARK("AoS - std::vector<Row>")
+    {
+        double sum = 0.0;
+        for (const auto& row : aos)
+            sum += std::get<1>(row.data);
+        return sum;
+    };
+
+    BENCHMARK("SoA - Table::column")
+    {
+        auto values = soa.column<1>();
+        return std::accumulate(values.begin(), values.end(), 0.0);
+    };
+}
@@ -0,0 +1,216 @@
+#ifndef VARIADIC_TEMPLATES_TYPELIST_HPP
+#define VARIADIC_TEMPLATES_TYPELIST_HPP
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+/////////////////////////////////////////////////////////////////
+// TypeList - compile-time list of types
+//
+// All operations are implemented with pack expansions (no head-tail recursion),
+// so the template instantiation depth does not grow with the length of the list.
+// Packs are expanded into array initializers instead of fold expressions -
+// clang limits the nesting of fold expressions to 256 operands by default.
+
+namespace VT
+{
+    template <typename... Ts>
+    struct TypeList
+    { };
+
+    constexpr static size_t npos = static_cast<size_t>(-1);
+
+    /////////////////////////////////////////////////////////////////
+    // Size
+
+    template <typename TList>
+    struct Size;
+
+    template <typename... Ts>
+    struct Size<TypeList<Ts...>> : std::integral_constant<size_t, sizeof...(Ts)>
+    { };
+
+    template <typename TList>
+    constexpr size_t Size_v = Size<TList>::value;
+
+    /////////////////////////////////////////////////////////////////
+    // At
+
+    namespace Detail
+    {
+        template <size_t I, typename T>
+        struct Indexed
+        {
+            using type = T;
+        };
+
+        template <typename IndexSeq, typename... Ts>
+        struct Indexer;
+
+        template <size_t... Is, typename... Ts>
+        struct Indexer<std::index_sequence<Is...>, Ts...> : Indexed<Is, Ts>...
+        { };
+
+        // overload resolution picks the only base with matching index - O(1) depth
+        template <size_t I, typename T>
+        Indexed<I, T> select(const Indexed<I, T>&);
+    } // namespace Detail
+
+    template <size_t I, typename TList>
+    struct At;
+
+    template <size_t I, typename... Ts>
+    struct At<I, TypeList<Ts...>>
+    {
+        static_assert(I < sizeof...(Ts), "Index out of range");
+
+#if defined(__cpp_pack_indexing) && __cpp_pack_indexing >= 202311L
+        using type = Ts...[I];
+#elif defined(__has_builtin) && __has_builtin(__type_pack_element)
+        using type = __type_pack_element<I, Ts...>;
+#else
+        using type = typename decltype(Detail::select<I>(
+            std::declval<const Detail::Indexer<std::index_sequence_for<Ts...>, Ts...>&>()))::type;
+#endif
+    };
+
+    template <size_t I, typename TList>
+    using At_t = typename At<I, TList>::type;
+
+    /////////////////////////////////////////////////////////////////
+    // IndexOf & Contains
+
+    namespace Detail
+    {
+        template <typename T, typename... Ts>
+        constexpr size_t index_of()
+        {
+            // the builtin avoids instantiating a std::is_same specialization for every pair of types
+#if defined(__has_builtin) && __has_builtin(__is_same)
+            constexpr bool matches[] = {__is_same(T, Ts)..., false};
+#else
+            constexpr bool matches[] = {std::is_same_v<T, Ts>..., false};
+#endif
+
+            for (size_t i = 0; i < sizeof...(Ts); ++i)
+                if (matches[i])
+                    return i;
+
+            return npos;
+        }
+    } // namespace Detail
+
+    template <typename T, typename TList>
+    struct Contains;
+
+    template <typename T, typename... Ts>
+    struct Contains<T, TypeList<Ts...>> : std::bool_constant<Detail::index_of<T, Ts...>() != npos>
+    { };
+
+    template <typename T, typename TList>
+    constexpr bool Contains_v = Contains<T, TList>::value;
+
+    template <typename T, typename TList>
+    struct IndexOf;
+
+    template <typename T, typename... Ts>
+    struct IndexOf<T, TypeList<Ts...>> : std::integral_constant<size_t, Detail::index_of<T, Ts...>()>
+    {
+        static_assert(IndexOf::value != npos, "Type not found in TypeList");
+    };
+
+    template <typename T, typename TList>
+    constexpr size_t IndexOf_v = IndexOf<T, TList>::value;
+
+    /////////////////////////////////////////////////////////////////
+    // Transform
+
+    template <template <typename> class F, typename TList>
+    struct Transform;
+
+    template <template <typename> class F, typename... Ts>
+    struct Transform<F, TypeList<Ts...>>
+    {
+        using type = TypeList<F<Ts>...>;
+    };
+
+    template <template <typename> class F, typename TList>
+    using Transform_t = typename Transform<F, TList>::type;
+
+    /////////////////////////////////////////////////////////////////
+    // Filter & Unique - both select a subset of indexes with a mask
+
+    namespace Detail
+    {
+        template <bool... Mask>
+        struct SelectedIndexes
+        {
+            static constexpr std::array<bool, sizeof...(Mask)> mask{Mask...};
+
+            static constexpr size_t count = [] {
+                size_t result = 0;
+                for (bool selected : mask)
+                    result += selected;
+                return result;
+            }();
+
+            static constexpr std::array<size_t, count> value = [] {
+                std::array<size_t, count> result{};
+                size_t pos = 0;
+                for (size_t i = 0; i < mask.size(); ++i)
+                    if (mask[i])
+                        result[pos++] = i;
+                return result;
+            }();
+        };
+
+        template <typename TList, typename TSelected, typename IndexSeq = std::make_index_sequence<TSelected::count>>
+        struct Gather;
+
+        template <typename TList, typename TSelected, size_t... Is>
+        struct Gather<TList, TSelected, std::index_sequence<Is...>>
+        {
+            using type = TypeList<At_t<TSelected::value[Is], TList>...>;
+        };
+    } // namespace Detail
+
+    template <template <typename> class Predicate, typename TList>
+    struct Filter;
+
+    template <template <typename> class Predicate, typename... Ts>
+    struct Filter<Predicate, TypeList<Ts...>>
+    {
+        using type = typename Detail::Gather<TypeList<Ts...>, Detail::SelectedIndexes<Predicate<Ts>::value...>>::type;
+    };
+
+    template <template <typename> class Predicate, typename TList>
+    using Filter_t = typename Filter<Predicate, TList>::type;
+
+    template <typename TList>
+    struct Unique;
+
+    template <typename... Ts>
+    struct Unique<TypeList<Ts...>>
+    {
+    private:
+        template <typename IndexSeq>
+        struct FirstOccurrences;
+
+        template <size_t... Is>
+        struct FirstOccurrences<std::index_sequence<Is...>>
+        {
+            using type = Detail::SelectedIndexes<(Detail::index_of<Ts, Ts...>() == Is)...>;
+        };
+
+    public:
+        using type = typename Detail::Gather<TypeList<Ts...>,
+            typename FirstOccurrences<std::index_sequence_for<Ts...>>::type>::type;
+    };
+
+    template <typename TList>
+    using Unique_t = typename Unique<TList>::type;
+} // namespace VT
+
+#endif // VARIADIC_TEMPLATES_TYPELIST_HPP
@@ -0,0 +1,60 @@
+#include "typelist.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+using namespace VT;
+
+namespace
+{
+    using Types = TypeList<int, double, std::string, int, const char*, double>;
+}
+
+TEST_CASE("TypeList - size")
+{
+    static_assert(Size_v<TypeList<>> == 0);
+    static_assert(Size_v<Types> == 6);
+}
+
+TEST_CASE("TypeList - at")
+{
+    static_assert(std::is_same_v<At_t<0, Types>, int>);
+    static_assert(std::is_same_v<At_t<2, Types>, std::string>);
+    static_assert(std::is_same_v<At_t<5, Types>, double>);
+    static_assert(std::is_same_v<At_t<1, TypeList<void, int&, const void>>, int&>);
+    static_assert(std::is_same_v<At_t<2, TypeList<void, int&, const void>>, const void>);
+}
+
+TEST_CASE("TypeList - index_of & contains")
+{
+    static_assert(IndexOf_v<int, Types> == 0);
+    static_assert(IndexOf_v<std::string, Types> == 2);
+    static_assert(IndexOf_v<const char*, Types> == 4);
+
+    static_assert(Contains_v<double, Types>);
+    static_assert(!Contains_v<float, Types>);
+    static_assert(!Contains_v<int, TypeList<>>);
+}
+
+TEST_CASE("TypeList - transform")
+{
+    static_assert(std::is_same_v<Transform_t<std::add_pointer_t, TypeList<int, const char>>, TypeList<int*, const char*>>);
+    static_assert(std::is_same_v<Transform_t<std::unique_ptr, TypeList<>>, TypeList<>>);
+}
+
+TEST_CASE("TypeList - filter")
+{
+    static_assert(std::is_same_v<Filter_t<std::is_arithmetic, Types>, TypeList<int, double, int, double>>);
+    static_assert(std::is_same_v<Filter_t<std::is_pointer, Types>, TypeList<const char*>>);
+    static_assert(std::is_same_v<Filter_t<std::is_void, Types>, TypeList<>>);
+    static_assert(std::is_same_v<Filter_t<std::is_void, TypeList<>>, TypeList<>>);
+}
+
+TEST_CASE("TypeList - unique")
+{
+    static_assert(std::is_same_v<Unique_t<Types>, TypeList<int, double, std::string, const char*>>);
+    static_assert(std::is_same_v<Unique_t<TypeList<int, int, int>>, TypeList<int>>);
+    static_assert(std::is_same_v<Unique_t<TypeList<>>, TypeList<>>);
+}
@@ -1,6 +1,14 @@
+#include "record_view.hpp"
+#include "static_vector.hpp"
+#include "table.hpp"
+#include "typelist.hpp"
+
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <iostream>
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -8,18 +16,6 @@
 
 using namespace std::literals;
 
-template <typename... Types>
-struct Row
-{
-    std::tuple<Types...> data;
-};
-
-template <typename... Types>
-struct Pointers
-{
-    std::tuple<const Types*...> ptrs;
-};
-
 template <size_t... Indexes>
 struct IndexSequence
 { };
@@ -81,23 +77,39 @@ namespace VT
 
     //////////////////////////////////////////////////////
 
-    template <typename... Types>
-    struct Count;
-
-    template <typename Head, typename... Tail>
-    struct Count<Head, Tail...>
+    namespace ver_1
     {
-        constexpr static int value = 1 + Count<Tail...>::value; // expansion pack
-    };
+        template <typename... Types>
+        struct Count;
+
+        template <typename Head, typename... Tail>
+        struct Count<Head, Tail...>
+        {
+            constexpr static int value = 1 + Count<Tail...>::value; // expansion pack
+        };
+
+        template <>
+        struct Count<>
+        {
+            constexpr static int value = 0;
+        };
+
+        //...
+        static_assert(Count<int, double, std::string&>::value == 3, "must be 3");
+    } // namespace ver_1
 
-    template <>
-    struct Count<>
+    inline namespace ver_2
     {
-        constexpr static int value = 0;
-    };
+        // no recursion - instantiation depth does not depend on the number of types
+        template <typename... Types>
+        struct Count
+        {
+            constexpr static int value = Size_v<TypeList<Types...>>;
+        };
 
-    //...
-    static_assert(Count<int, double, std::string&>::value == 3, "must be 3");
+        static_assert(Count<int, double, std::string&>::value == 3, "must be 3");
+        static_assert(Count<>::value == 0);
+    } // namespace ver_2
 
 } // namespace VT
 
@@ -177,7 +189,7 @@ namespace VT::Folds
         }
     } // namespace ver_1
 
-    inline namespace ver_3
+    namespace ver_3
     {
         template <typename... Args>
         auto make_vector(Args&&... args)
@@ -192,6 +204,57 @@ namespace VT::Folds
             return vec;
         }
     } // namespace ver_1
+
+    inline namespace ver_4
+    {
+        template <typename... Args>
+        auto make_vector(Args&&... args) requires (!(... || std::is_same_v<std::remove_cvref_t<Args>, std::allocator_arg_t>))
+        {
+            using T = std::common_type_t<Args...>;
+
+            std::vector<T> vec;
+            vec.reserve(sizeof...(args));
+
+            (..., vec.emplace_back(std::forward<Args>(args))); // constructed in place
+
+            return vec;
+        }
+
+        // make_vector(std::allocator_arg, std::pmr::polymorphic_allocator<>{&resource}, 1, 2, 3)
+        template <typename Allocator, typename... Args>
+        auto make_vector(std::allocator_arg_t, const Allocator& alloc, Args&&... args)
+        {
+            using T = std::common_type_t<Args...>;
+            using TAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+
+            std::vector<T, TAllocator> vec(TAllocator{alloc});
+            vec.reserve(sizeof...(args));
+
+            (..., vec.emplace_back(std::forward<Args>(args)));
+
+            return vec;
+        }
+
+        // small packs are stored inline - no allocation at all
+        template <size_t InlineCapacity = 8, typename... Args>
+        auto make_small_vector(Args&&... args)
+        {
+            using T = std::common_type_t<Args...>;
+
+            if constexpr (sizeof...(Args) <= InlineCapacity)
+            {
+                StaticVector<T, sizeof...(Args)> vec;
+
+                (..., vec.emplace_back(std::forward<Args>(args)));
+
+                return vec;
+            }
+            else
+            {
+                return make_vector(std::forward<Args>(args)...);
+            }
+        }
+    } // namespace ver_4
 } // namespace VT::Folds
 
 TEST_CASE("make_vector")
@@ -208,4 +271,70 @@ TEST_CASE("make_vector")
     // std::vector<std::unique_ptr<int>> vec_ptrs;
     // vec_ptrs.push_back(std::make_unique<int>(42));
     // vec_ptrs.push_back(std::make_unique<int>(665));
-}
\ No newline at end of file
+}
+
+TEST_CASE("make_vector - in place construction")
+{
+    SECTION("elements are constructed with exact capacity")
+    {
+        auto vec = VT::Folds::make_vector("one"s, "two", "three"s);
+
+        static_assert(std::is_same_v<decltype(vec), std::vector<std::string>>);
+        CHECK(vec == std::vector{"one"s, "two"s, "three"s});
+        CHECK(vec.capacity() == 3);
+    }
+
+    SECTION("pmr allocator")
+    {
+        std::array<std::byte, 1024> buffer;
+        std::pmr::monotonic_buffer_resource resource{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+
+        auto vec = VT::Folds::make_vector(std::allocator_arg, std::pmr::polymorphic_allocator<>{&resource}, 1, 2, 3);
+
+        static_assert(std::is_same_v<decltype(vec), std::pmr::vector<int>>);
+        CHECK(vec == std::pmr::vector<int>{1, 2, 3});
+        CHECK(reinterpret_cast<std::byte*>(vec.data()) >= buffer.data());
+        CHECK(reinterpret_cast<std::byte*>(vec.data()) < buffer.data() + buffer.size());
+    }
+
+    SECTION("small packs are stored inline")
+    {
+        auto small = VT::Folds::make_small_vector(1, 2, 3);
+        static_assert(std::is_same_v<decltype(small), StaticVector<int, 3>>);
+        CHECK(small.size() == 3);
+        CHECK(small[2] == 3);
+
+        auto ptrs = VT::Folds::make_small_vector(std::make_unique<int>(42), std::make_unique<int>(665));
+        CHECK(*ptrs[1] == 665);
+
+        auto large = VT::Folds::make_small_vector<2>(1, 2, 3);
+        static_assert(std::is_same_v<decltype(large), std::vector<int>>);
+    }
+}
+
+TEST_CASE("make_vector - tiny vectors", "[.][benchmark]")
+{
+    BENCHMARK("push_back - ver_3")
+    {
+        return VT::Folds::ver_3::make_vector(1, 2, 3, 4, 5, 6).size();
+    };
+
+    BENCHMARK("emplace_back - ver_4")
+    {
+        return VT::Folds::make_vector(1, 2, 3, 4, 5, 6).size();
+    };
+
+    std::array<std::byte, 4096> buffer;
+    std::pmr::monotonic_buffer_resource resource{buffer.data(), buffer.size()};
+
+    BENCHMARK("pmr - monotonic buffer")
+    {
+        resource.release();
+        return VT::Folds::make_vector(std::allocator_arg, std::pmr::polymorphic_allocator<>{&resource}, 1, 2, 3, 4, 5, 6).size();
+    };
+
+    BENCHMARK("inline - StaticVector")
+    {
+        return VT::Folds::make_small_vector(1, 2, 3, 4, 5, 6).size();
+    };
+}